@@ -4,9 +4,35 @@
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/transaction/transaction_manager.hpp"
 #include "oracle_connection.hpp"
+#include "oracle_io_executor.hpp"
+#include "oracle_memory_budget.hpp"
 
 namespace duckdb {
 
+// ───────────────────────────────────────────────────────────────────────────────
+// OracleNumberNarrowing: 精度なし NUMBER 列の整数化の判定結果（NUMBER_NARROWING）
+//
+// 判定には統計の参照と標本の読み取りが要るので、表ごとに 1 度だけ行って
+// カタログに残す。スキャン中に整数でない値が出た表は以後整数化しない。
+// ───────────────────────────────────────────────────────────────────────────────
+class OracleNumberNarrowing {
+public:
+    using columns_t = std::unordered_map<std::string, int32_t>;  // 列名 → 推定精度
+
+    // table_key（"SCHEMA.TABLE"）の判定結果。未判定なら false
+    bool Get(const std::string &table_key, columns_t &columns);
+    void Set(const std::string &table_key, columns_t columns);
+
+    // 実行時に整数でない値が出た。以後この表の列は整数化しない
+    void Reject(const std::string &table_key);
+
+    void Clear();
+
+private:
+    std::mutex mutex_;
+    std::unordered_map<std::string, columns_t> tables_;
+};
+
 // ───────────────────────────────────────────────────────────────────────────────
 // OracleCatalog: DuckDB Catalog の Oracle 実装
 // ───────────────────────────────────────────────────────────────────────────────
@@ -44,6 +70,9 @@ public:
 
     // ─── 接続 & キャッシュ ─────────────────────────────────────────────────────
     OracleConnectionPool &GetConnectionPool() { return *pool_; }
+    OracleIOExecutor     &GetIOExecutor() { return *io_executor_; }
+    OracleMemoryBudget   &GetMemoryBudget() { return *memory_budget_; }
+    OracleNumberNarrowing &GetNumberNarrowing() { return number_narrowing_; }
     void ClearCache();
 
     // ─── スキーマキャッシュ ────────────────────────────────────────────────────
@@ -52,6 +81,9 @@ public:
 private:
     OracleConnectionParameters params_;
     unique_ptr<OracleConnectionPool> pool_;
+    unique_ptr<OracleMemoryBudget>   memory_budget_; // フェッチバッファの予算（スキャンより長く生きる）
+    unique_ptr<OracleIOExecutor>     io_executor_;  // 全スキャン共有の I/O スレッドプール
+    OracleNumberNarrowing            number_narrowing_;
 
     // スキーマエントリキャッシュ
     unordered_map<string, unique_ptr<SchemaCatalogEntry>> schema_cache_;
@@ -66,8 +98,23 @@ private:
 // ───────────────────────────────────────────────────────────────────────────────
 class OracleTransaction : public Transaction {
 public:
-    OracleTransaction(TransactionManager &manager, ClientContext &context);
+    OracleTransaction(TransactionManager &manager, ClientContext &context,
+                      OracleCatalog &catalog);
     ~OracleTransaction() override = default;
+
+    static OracleTransaction &Get(ClientContext &context, Catalog &catalog);
+
+    // CONSISTENT_SNAPSHOT 有効時にこのトランザクションが読む SCN（0 = 使わない）。
+    // 最初のスキャンのバインドで SCN を取得し、その表に AS OF SCN を 1 度試す。
+    // フラッシュバック固有のエラーならトランザクション全体で 0 に固定する
+    uint64_t GetSnapshotSCN(OracleConnection &conn, const std::string &schema,
+                            const std::string &table);
+
+private:
+    bool       consistent_snapshot_ = false;
+    bool       snapshot_resolved_   = false;
+    uint64_t   snapshot_scn_        = 0;
+    std::mutex snapshot_mutex_;
 };
 
 class OracleTransactionManager : public TransactionManager {
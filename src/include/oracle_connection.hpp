@@ -6,6 +6,7 @@
 #include <dpi.h>
 #include <mutex>
 #include <vector>
+#include <unordered_map>
 #include <functional>
 #include <memory>
 
@@ -20,6 +21,46 @@ struct OracleTableInfo {
     bool        is_view = false;
 };
 
+// ───────────────────────────────────────────────────────────────────────────────
+// スキャン対象の種類（並列化の方法が変わる）
+// ───────────────────────────────────────────────────────────────────────────────
+enum class OracleTableKind : uint8_t {
+    HEAP_TABLE,   // 通常の表（物理 ROWID で範囲分割できる）
+    IOT,          // 索引構成表（論理 ROWID のみ）
+    VIEW
+};
+
+// ───────────────────────────────────────────────────────────────────────────────
+// ROWID 範囲分割用のエクステント情報（半開区間 [rowid_lo, rowid_hi)）
+// ───────────────────────────────────────────────────────────────────────────────
+struct OracleExtentInfo {
+    std::string rowid_lo;   // エクステント先頭ブロックの最初の ROWID
+    std::string rowid_hi;   // エクステント直後のブロックの最初の ROWID
+    idx_t       bytes = 0;
+};
+
+// ───────────────────────────────────────────────────────────────────────────────
+// パーティション / サブパーティション情報
+// ───────────────────────────────────────────────────────────────────────────────
+struct OraclePartitionInfo {
+    std::string name;                   // PARTITION_NAME / SUBPARTITION_NAME
+    std::string parent;                 // サブパーティションの親パーティション名
+    bool        is_subpartition = false;
+    idx_t       bytes = 0;              // 統計によるサイズ見積り
+
+    // 最上位パーティションの境界（サブパーティションは親のもの）
+    idx_t       position = 0;           // PARTITION_POSITION
+    std::string high_value;             // HIGH_VALUE（LONG の SQL テキスト）
+};
+
+// ───────────────────────────────────────────────────────────────────────────────
+// パーティション方式（ALL_PART_TABLES / ALL_PART_KEY_COLUMNS）
+// ───────────────────────────────────────────────────────────────────────────────
+struct OraclePartitionScheme {
+    std::string              type;         // RANGE / LIST / HASH / ...（空 = 非パーティション表）
+    std::vector<std::string> key_columns;  // 最上位のパーティションキー（COLUMN_POSITION 順）
+};
+
 // ───────────────────────────────────────────────────────────────────────────────
 // OracleConnection: ODPI-C 接続ラッパー（スレッドセーフ）
 // ───────────────────────────────────────────────────────────────────────────────
@@ -36,6 +77,66 @@ public:
     std::vector<OracleColumnInfo> GetColumns(const std::string &schema,
                                               const std::string &table);
 
+    // ─── 並列スキャン用メタデータ ──────────────────────────────────────────────
+    // 表 / IOT / ビューの別。見つからなければ HEAP_TABLE。
+    // avg_row_len には ALL_TABLES.AVG_ROW_LEN を返す（統計なし・ビューは 0）
+    OracleTableKind GetTableKind(const std::string &schema, const std::string &table,
+                                 idx_t *avg_row_len = nullptr);
+
+    // 列名 → ALL_TAB_COL_STATISTICS.NUM_DISTINCT（統計のある列のみ）
+    std::unordered_map<std::string, idx_t> GetColumnDistinctCounts(const std::string &schema,
+                                                                   const std::string &table);
+
+    // 空間索引のある SDO_GEOMETRY 列 → ALL_SDO_GEOM_METADATA の SRID
+    // （SQL にそのまま埋め込める表記。SRID がなければ "NULL"）
+    std::unordered_map<std::string, std::string> GetSpatialIndexColumns(const std::string &schema,
+                                                                        const std::string &table);
+
+    // 精度なし NUMBER 列のうち整数とみなせる列 → 推定精度（18 = BIGINT、38 = HUGEINT）。
+    // LOW_VALUE / HIGH_VALUE が整数で、標本に小数がない列だけを返す
+    std::unordered_map<std::string, int32_t> GetIntegralNumberColumns(const std::string &schema,
+                                                                      const std::string &table);
+
+    // 主キー列（POSITION 順）。主キーがなければ空
+    std::vector<std::string> GetPrimaryKeyColumns(const std::string &schema,
+                                                  const std::string &table);
+
+    // 非パーティション表のエクステントを (ファイル, ブロック) 順に返す。
+    // DBA_EXTENTS → USER_EXTENTS の順に試し、参照できなければ空。
+    std::vector<OracleExtentInfo> GetTableExtents(const std::string &schema,
+                                                   const std::string &table);
+
+    // パーティション表の各セグメントのエクステントを (ファイル, ブロック) 順に返す。
+    // キーはパーティション名（サブパーティション表ならサブパーティション名）
+    std::unordered_map<std::string, std::vector<OracleExtentInfo>>
+    GetPartitionExtents(const std::string &schema, const std::string &table);
+
+    // ALL_TABLES の統計（NUM_ROWS * AVG_ROW_LEN）によるサイズ見積り。不明なら 0
+    idx_t GetTableSizeEstimate(const std::string &schema, const std::string &table);
+
+    // 最上位のパーティション方式とキー列。非パーティション表なら type が空
+    OraclePartitionScheme GetPartitionScheme(const std::string &schema,
+                                             const std::string &table);
+
+    // パーティション表なら ALL_TAB_SUBPARTITIONS（なければ ALL_TAB_PARTITIONS）
+    // の各セグメントを返す。非パーティション表なら空
+    std::vector<OraclePartitionInfo> GetPartitions(const std::string &schema,
+                                                   const std::string &table);
+
+    // 数値 / 日付のキー列を num_ranges 等分する境界値を SQL リテラルで返す（昇順）。
+    // ALL_TAB_HISTOGRAMS のエンドポイントの累積行数で区切り、ヒストグラムが
+    // なければ SAMPLE + NTILE で求める。先頭区間の下限・末尾区間の上限は含まない
+    std::vector<std::string> GetKeyRangeBoundaries(const std::string &schema,
+                                                   const std::string &table,
+                                                   const std::string &column,
+                                                   bool is_date, idx_t num_ranges);
+
+    // ブロックサンプリングで num_ranges 等分する ROWID 境界を求める
+    // （先頭区間の下限は含まない。DBMS_PARALLEL_EXECUTE の ROWID 分割に相当）
+    std::vector<std::string> GetSampledRowidBoundaries(const std::string &schema,
+                                                        const std::string &table,
+                                                        idx_t num_ranges);
+
     // ─── クエリ実行 ────────────────────────────────────────────────────────────
     // callback は DataChunk ごとに呼ばれる。戻り値が false なら中断。
     void ExecuteQuery(const std::string &sql,
@@ -55,15 +156,38 @@ public:
     std::string GetServerVersion();
     int         GetServerMajorVersion();
 
+    // 別スレッドで実行中の呼び出しを中断させる（ブロック中のフェッチを打ち切る）
+    void BreakExecution();
+
+    // 現在の SCN。V$DATABASE → DBMS_FLASHBACK の順に試し、どちらも使えなければ 0
+    uint64_t    GetCurrentSCN();
+
+    // schema.table を AS OF SCN で読めるか。フラッシュバック固有のエラー（権限なし、
+    // 定義変更後の SCN、UNDO 切れ）なら false、それ以外のエラーはそのまま例外
+    bool        CanReadAsOf(const std::string &schema, const std::string &table,
+                            uint64_t scn);
+
     // ─── パラメータ ────────────────────────────────────────────────────────────
     const OracleConnectionParameters &GetParams() const { return params_; }
 
+    // ─── 低レベルアクセス（OracleQueryCursor 用） ──────────────────────────────
+    dpiConn *GetHandle() const { return conn_; }
+    void ThrowIfError(int rc, const std::string &context);
+
 private:
     OracleConnection() = default;
 
-    void ThrowIfError(int rc, const std::string &context);
     void SetupContext();
 
+    // sql を実行し、各行について row を呼ぶ（ロックは呼び出し側で取る）
+    void ForEachRow(const std::string &sql, const std::string &context,
+                    const std::function<void(dpiStmt *)> &row);
+
+    // GetTableExtents / GetPartitionExtents の本体。partitioned ならパーティションの
+    // セグメントを読み、row にはパーティション名も渡す（ロックは呼び出し側で取る）
+    void ReadExtents(const std::string &schema, const std::string &table, bool partitioned,
+                     const std::function<void(const std::string &, OracleExtentInfo)> &row);
+
     OracleConnectionParameters params_;
     dpiContext *ctx_   = nullptr;
     dpiConn    *conn_  = nullptr;
@@ -88,6 +212,8 @@ public:
 
     void ClearCache();
 
+    const OracleConnectionParameters &GetParams() const { return params_; }
+
 private:
     OracleConnectionParameters params_;
     size_t max_connections_;
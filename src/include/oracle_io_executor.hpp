@@ -0,0 +1,181 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "oracle_memory_budget.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace duckdb {
+
+// ───────────────────────────────────────────────────────────────────────────────
+// OracleSPSCQueue: 固定長のシングルプロデューサ / シングルコンシューマ キュー
+//
+// Push 側・Pop 側がそれぞれ同時に 1 スレッドだけなら lock-free に動く。
+// Push するスレッドが入れ替わる場合は、入れ替わり自体を別の同期
+// （OracleIOExecutor の mutex）で順序付けること。
+// ───────────────────────────────────────────────────────────────────────────────
+template <class T>
+class OracleSPSCQueue {
+public:
+    explicit OracleSPSCQueue(idx_t capacity) : buffer_(capacity + 1) {}
+
+    bool Push(T value) {
+        idx_t tail = tail_.load(std::memory_order_relaxed);
+        idx_t next = (tail + 1) % buffer_.size();
+        if (next == head_.load(std::memory_order_acquire)) {
+            return false; // 満杯
+        }
+        buffer_[tail] = std::move(value);
+        tail_.store(next, std::memory_order_release);
+        return true;
+    }
+
+    bool Pop(T &value) {
+        idx_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return false; // 空
+        }
+        value = std::move(buffer_[head]);
+        head_.store((head + 1) % buffer_.size(), std::memory_order_release);
+        return true;
+    }
+
+    bool Empty() const {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+private:
+    std::vector<T>     buffer_;
+    std::atomic<idx_t> head_{0};
+    std::atomic<idx_t> tail_{0};
+};
+
+class OracleIOExecutor;
+
+// OracleIOStream::TryNext の結果
+enum class OracleIOStatus : uint8_t {
+    READY,    // output にチャンクを渡した
+    PENDING,  // まだ届いていない（Wait で I/O スレッドに起こしてもらう）
+    FINISHED  // 結果が尽きた
+};
+
+// ───────────────────────────────────────────────────────────────────────────────
+// OracleIOStream: 1 スキャンワーカー分の先読みストリーム
+//
+// I/O スレッドが produce を呼んで DataChunk を埋め、ready キューに積む。
+// 消費側（DuckDB のワーカースレッド）は TryNext / Next で受け取り、使い終わった
+// チャンクは次の呼び出しで free キューに戻す。produce を実行する I/O スレッドは
+// 同時に 1 つだけなので、2 つのキューはどちらも SPSC で足りる。
+// ───────────────────────────────────────────────────────────────────────────────
+class OracleIOStream : public std::enable_shared_from_this<OracleIOStream> {
+public:
+    // produce: chunk に次の結果を詰める。結果が尽きたら false
+    using produce_t = std::function<bool(DataChunk &chunk)>;
+
+    // capacity 個分のスロットを budget から予約する。足りなければ先読みを浅くする
+    OracleIOStream(const std::vector<LogicalType> &types, idx_t capacity,
+                   OracleMemoryBudget *budget, idx_t chunk_bytes,
+                   produce_t produce, std::function<void()> interrupt);
+
+    // 先読み済みのチャンクがあれば output に参照させる。待たずに返るので、
+    // PENDING なら Wait の後で呼び直す。I/O 側で発生した例外はここで再送出する
+    OracleIOStatus TryNext(DataChunk &output);
+
+    // チャンクが積まれるか、終わるか、取り消されるまで待つ
+    void Wait();
+
+    // TryNext と Wait を繰り返す。結果が尽きたら false
+    bool Next(DataChunk &output);
+
+    // 以降 produce を呼ばせず、実行中なら終わるまで待つ
+    void Cancel();
+
+private:
+    friend class OracleIOExecutor;
+
+    // I/O スレッドから 1 チャンク分進め、続けられるなら実行待ちに戻す
+    void RunOnce();
+
+    // 空きスロットがあり、まだ終わっていなければ実行待ちに入れる
+    void ScheduleIfRunnable();
+
+    OracleIOExecutor     *executor_ = nullptr;
+    const void           *group_ = nullptr;    // 公平性の単位（クエリ）
+    produce_t             produce_;
+    std::function<void()> interrupt_;          // Cancel 時にブロック中のフェッチを打ち切る
+
+    std::vector<unique_ptr<DataChunk>> slots_;
+    OracleMemoryReservation      reservation_; // slots_ 分の予約
+    OracleSPSCQueue<DataChunk *> free_;        // 消費側 → I/O スレッド
+    OracleSPSCQueue<DataChunk *> ready_;       // I/O スレッド → 消費側
+    DataChunk *current_ = nullptr;             // 消費側が参照中のスロット
+
+    std::atomic<bool> scheduled_{false};       // 実行待ち or 実行中
+    std::atomic<bool> finished_{false};
+    std::atomic<bool> cancelled_{false};
+    std::exception_ptr error_;                 // finished_ の前に書く
+
+    // 消費側の待機用（データの受け渡し自体はキューで行う）
+    std::mutex              wait_mutex_;
+    std::condition_variable wait_cv_;
+    bool                    running_ = false;  // I/O スレッドが produce 実行中
+};
+
+// ───────────────────────────────────────────────────────────────────────────────
+// OracleIOExecutor: ATTACH したデータベースごとの Oracle I/O スレッドプール
+//
+// ODPI-C のブロッキング呼び出し（execute / fetchRows）と変換を DuckDB の
+// ワーカースレッドから切り離す。実行待ちのストリームはクエリ（グループ）
+// ごとにまとめ、グループ間・グループ内ともに 1 チャンクずつラウンドロビンで
+// 回すので、大きなエクスポートが対話的な問い合わせを飢えさせない。
+// この実行待ちの管理はグループの付け替えを伴うので mutex で守る（チャンクの
+// 受け渡しは各ストリームの SPSC キューで、ここは 1 チャンクに 1 回しか通らない）。
+// ───────────────────────────────────────────────────────────────────────────────
+class OracleIOExecutor {
+public:
+    explicit OracleIOExecutor(idx_t num_threads);
+    ~OracleIOExecutor();
+
+    OracleIOExecutor(const OracleIOExecutor &) = delete;
+    OracleIOExecutor &operator=(const OracleIOExecutor &) = delete;
+
+    // ストリームを作って実行を始める。group が同じストリームは 1 つの
+    // 公平性単位として扱う（通常は ClientContext）。chunk_bytes は 1 チャンクの
+    // 見積もりで、先読みするチャンクを budget に計上する
+    std::shared_ptr<OracleIOStream> Start(const void *group,
+                                          const std::vector<LogicalType> &types,
+                                          idx_t capacity, OracleMemoryBudget *budget,
+                                          idx_t chunk_bytes, OracleIOStream::produce_t produce,
+                                          std::function<void()> interrupt);
+
+private:
+    friend class OracleIOStream;
+
+    struct Group {
+        std::deque<std::shared_ptr<OracleIOStream>> runnable;
+    };
+
+    void Enqueue(std::shared_ptr<OracleIOStream> stream);
+    void WorkerLoop();
+
+    idx_t num_threads_;
+    std::vector<std::thread> threads_;
+
+    std::mutex              mutex_;
+    std::condition_variable cv_;
+    bool                    shutdown_ = false;
+    // 実行待ちのあるグループ（先頭から 1 ストリームずつ取り出して末尾に回す）
+    std::list<std::shared_ptr<Group>>                       active_;
+    std::unordered_map<const void *, std::shared_ptr<Group>> groups_;
+};
+
+} // namespace duckdb
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include <dpi.h>
+#include <string>
+
+namespace duckdb {
+
+// ───────────────────────────────────────────────────────────────────────────────
+// OracleJson: JSON 列（OSON）のクライアント側デコード
+//
+// JSON 列は DPI_NATIVE_TYPE_JSON で define し、サーバーにはテキストへの
+// 直列化をさせずにバイナリ（OSON）のまま受け取る。dpiJson_getValue で得た
+// ノード木を、JSON 型ならテキストに、STRUCT / LIST 等が指定されていれば
+// 列のベクタへ直接書き込む。数値は 10 進テキスト（NUMBER_AS_STRING）で
+// 受け取るので、どちらの経路でも桁が落ちない。
+// ───────────────────────────────────────────────────────────────────────────────
+class OracleJson {
+public:
+    // dpiJson_getValue に渡すオプション
+    static constexpr uint32_t GET_VALUE_OPTIONS = DPI_JSON_OPT_NUMBER_AS_STRING;
+
+    // node を JSON テキストとして out の末尾に追加する
+    static void AppendText(const dpiJsonNode *node, std::string &out);
+
+    // node を result[row] に書き込む。result の型（STRUCT / LIST / スカラー）に
+    // 合わせて再帰する。JSON 型・VARCHAR にはテキストを書く
+    static void Write(const dpiJsonNode *node, Vector &result, idx_t row);
+
+private:
+    // スカラーのノードを Value にする（数値は 10 進テキストのまま VARCHAR）
+    static Value ScalarValue(const dpiJsonNode *node);
+};
+
+} // namespace duckdb
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace duckdb {
+
+class BufferManager;
+
+// ───────────────────────────────────────────────────────────────────────────────
+// OracleMemoryBudget: ATTACH したデータベースごとのフェッチ用メモリ予算
+//
+// ODPI-C の define バッファや先読みチャンクは DuckDB のバッファプールの外で
+// 確保されるので、確保する前にここで予約し、同じ量を BufferManager にも
+// 予約して memory_limit の計算に含めさせる。予算が足りなければしばらく
+// 解放を待ち、それでも足りなければ呼び出し側が示した最小量まで縮めて渡す。
+// ───────────────────────────────────────────────────────────────────────────────
+class OracleMemoryBudget {
+public:
+    OracleMemoryBudget(BufferManager &buffer_manager, idx_t limit);
+
+    OracleMemoryBudget(const OracleMemoryBudget &) = delete;
+    OracleMemoryBudget &operator=(const OracleMemoryBudget &) = delete;
+
+    // min_bytes 〜 want_bytes の範囲で予約し、予約できた量を返す。
+    // 空きが min_bytes に満たなければ最大 MAX_WAIT だけ解放を待ち、それでも
+    // 足りなければ予算を超えて min_bytes を渡す（進めなくなるよりは超過させる）。
+    // DuckDB 側でも min_bytes を確保できなければ OutOfMemoryException
+    idx_t Reserve(idx_t min_bytes, idx_t want_bytes);
+
+    void Release(idx_t bytes);
+
+    idx_t GetLimit() const { return limit_; }
+    idx_t GetReserved();
+
+    static constexpr std::chrono::milliseconds MAX_WAIT{2000};
+
+private:
+    // DuckDB のバッファマネージャに bytes を予約する。足りなければ半分ずつ
+    // 減らして min_bytes まで試す
+    idx_t ReserveFromBufferManager(idx_t min_bytes, idx_t bytes);
+
+    // 予算の計上だけを戻して待っている予約者を起こす
+    void ReturnToBudget(idx_t bytes);
+
+    BufferManager          &buffer_manager_;
+    idx_t                   limit_;
+    idx_t                   reserved_ = 0;
+    std::mutex              mutex_;
+    std::condition_variable cv_;
+};
+
+// ───────────────────────────────────────────────────────────────────────────────
+// OracleMemoryReservation: OracleMemoryBudget の予約を保持し、破棄時に返す
+// （budget が nullptr なら何もしない）
+// ───────────────────────────────────────────────────────────────────────────────
+class OracleMemoryReservation {
+public:
+    OracleMemoryReservation() = default;
+    ~OracleMemoryReservation() { Release(); }
+
+    OracleMemoryReservation(const OracleMemoryReservation &) = delete;
+    OracleMemoryReservation &operator=(const OracleMemoryReservation &) = delete;
+
+    // 既存の予約を返してから取り直す。予約できた量を返す
+    // （budget がなければ want_bytes をそのまま返す）
+    idx_t Reserve(OracleMemoryBudget *budget, idx_t min_bytes, idx_t want_bytes);
+    void  Release();
+
+    idx_t GetSize() const { return size_; }
+
+private:
+    OracleMemoryBudget *budget_ = nullptr;
+    idx_t               size_ = 0;
+};
+
+} // namespace duckdb
@@ -7,7 +7,8 @@
 
 namespace duckdb {
 
-class OracleScanBindData;
+struct OracleScanBindData;
+struct OracleColumnPredicate;
 
 // ───────────────────────────────────────────────────────────────────────────────
 // OracleFilterPushdown: DuckDB の Expression を Oracle SQL に変換
@@ -25,7 +26,24 @@ public:
                                  std::vector<std::string> &column_names,
                                  std::vector<unique_ptr<Expression>> &filters);
 
+    // 空間索引のある SDO_GEOMETRY 列と定数のジオメトリに対する空間述語
+    // （ST_Intersects 等）から、定数の外接矩形による SDO_FILTER を bind_data に
+    // 追加する。SDO_FILTER は候補行を絞るだけなので、filters は DuckDB 側にも残す
+    static void PushdownSpatialFilters(ClientContext &context, OracleScanBindData &bind_data,
+                                       const std::vector<std::string> &column_names,
+                                       const std::vector<unique_ptr<Expression>> &filters);
+
+    // bind_data.predicates とパーティションの HIGH_VALUE を突き合わせ、
+    // 一致する行を持ち得ないパーティションを bind_data.partitions から除く。
+    // 単一キーの RANGE / LIST パーティションのみ対象（それ以外は何もしない）
+    static void PrunePartitions(OracleScanBindData &bind_data);
+
 private:
+    // AND で結ばれた「カラム 比較 定数」を刈り込み用の述語として取り出す
+    static void CollectPredicates(const Expression &expr,
+                                  const std::vector<std::string> &col_names,
+                                  std::vector<OracleColumnPredicate> &predicates);
+
     static std::string ComparisonToSQL(const BoundComparisonExpression &expr,
                                         const std::vector<std::string> &col_names);
     static std::string ConjunctionToSQL(const BoundConjunctionExpression &expr,
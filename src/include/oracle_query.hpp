@@ -0,0 +1,156 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "oracle_type_mapping.hpp"
+#include "oracle_memory_budget.hpp"
+#include "oracle_utils.hpp"
+#include <dpi.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace duckdb {
+
+class OracleConnection;
+struct OracleDictionaryColumn;
+
+// ───────────────────────────────────────────────────────────────────────────────
+// フェッチ配列の大きさの決め方
+//
+// fixed_rows が 0 なら、列バッファが buffer_bytes に収まる範囲で配列を確保し、
+// 1 往復あたりの行数は平均行長から決めた初期値から実測の往復時間に応じて
+// 増やす。prefetch 行数も同じ初期値にして、execute の往復で先頭行を受け取る。
+// ───────────────────────────────────────────────────────────────────────────────
+struct OracleFetchSizing {
+    idx_t fixed_rows    = 0;                 // > 0 なら常にこの行数（FETCH_SIZE）
+    idx_t buffer_bytes  = 16 * 1024 * 1024;  // 全列のフェッチバッファの上限
+    idx_t avg_row_bytes = 0;                 // 平均行長（AVG_ROW_LEN 等。0 = 不明）
+    idx_t max_row_bytes = 0;                 // 定義上の最大行長（0 = 不明）
+    // define バッファを予約する予算（nullptr = 計上しない）。予算が足りなければ
+    // 配列を短くする
+    OracleMemoryBudget *budget = nullptr;
+
+    static OracleFetchSizing FromParams(const OracleConnectionParameters &params);
+
+    // execute 前に使う初期の行数（prefetch 行数・最初の往復）
+    idx_t InitialRows() const;
+};
+
+// ───────────────────────────────────────────────────────────────────────────────
+// OracleLobReader: LOB をチャンク単位で読み、ベクタの文字列ヒープに直接書く
+//
+// ヒープに最大バイト長の領域を確保してチャンクごとに直接読み込む。マルチバイトの
+// CLOB は読むまでバイト長が分からないので、読み終えてから実際の長さに縮める。
+// ロケータはカーソルのセッションに属し、1 セッションの呼び出しは直列に
+// なるので、同じバッチの LOB は順に読む（並行性はワーカー / セッション単位）。
+// 確保する領域は budget に予約し、予約はチャンクがリセットされるまで保持する。
+// ───────────────────────────────────────────────────────────────────────────────
+class OracleLobReader {
+public:
+    OracleLobReader(OracleConnection &conn, OracleMemoryBudget *budget)
+        : conn_(conn), budget_(budget) {}
+
+    // lob の値全体を result の文字列ヒープに読み込む
+    string_t Read(dpiLob *lob, Vector &result);
+
+private:
+    OracleConnection   &conn_;
+    OracleMemoryBudget *budget_;
+};
+
+// ───────────────────────────────────────────────────────────────────────────────
+// インラインで受け取る LOB 列
+//
+// SELECT 側で 1 つの LOB 列を「上限以下なら値」「超えたらロケータ」の 2 列に
+// 分けておき、前者を LONG / LONG RAW で define して行と一緒に受け取る。
+// 後者は上限を超えた行だけ非 NULL になり、その行だけ LOB を読みに行く。
+// ───────────────────────────────────────────────────────────────────────────────
+struct OracleLobFallback {
+    idx_t    column;        // 出力列の位置（インライン値の列）
+    idx_t    locator;       // クエリ上のロケータ列の位置（出力列より後ろ）
+    uint32_t inline_bytes;  // インライン値の define サイズ
+};
+
+// ───────────────────────────────────────────────────────────────────────────────
+// OracleQueryCursor: 1 つの SELECT を開いたまま前方フェッチするカーソル
+//
+// Scan 呼び出しをまたいで dpiStmt を保持し、結果が尽きるまで DataChunk
+// 単位で読み進める。各列は配列長ぶんの dpiVar を define しておき、
+// dpiStmt_fetchRows で配列ごと受け取って列方向に変換する。配列長と
+// 1 往復あたりの行数は OracleFetchSizing に従う。
+// dictionary_columns に挙げた文字列列は、チャンク内の異なる値を 1 度だけ
+// 辞書に置き、出力を辞書ベクトル（辞書 + 選択ベクトル）にする。
+// 異なる値が多すぎたらその列は通常の変換に戻す。
+// 呼び出し側が途中で読むのをやめた場合（LIMIT 等）はデストラクタで
+// カーソルを閉じる。接続の排他は呼び出し側の責任。
+// ───────────────────────────────────────────────────────────────────────────────
+class OracleQueryCursor {
+public:
+    OracleQueryCursor(OracleConnection &conn, const std::string &sql,
+                      const std::vector<LogicalType> &types,
+                      const OracleFetchSizing &sizing,
+                      const std::vector<OracleLobFallback> &lob_fallbacks = {},
+                      const std::vector<idx_t> &dictionary_columns = {});
+    ~OracleQueryCursor();
+
+    OracleQueryCursor(const OracleQueryCursor &) = delete;
+    OracleQueryCursor &operator=(const OracleQueryCursor &) = delete;
+
+    // output に最大 STANDARD_VECTOR_SIZE 行を詰める。結果が尽きたら false
+    bool Fetch(DataChunk &output);
+
+    // カーソルを閉じる（何度呼んでもよい）
+    void Close();
+
+    bool IsDone() const { return done_; }
+
+private:
+    // クエリ情報から列ごとの変換カーネルを選び、フェッチ配列を define する
+    void SetupColumns();
+
+    // 次のフェッチ配列を取得する。行がなければ false
+    bool FetchBatch();
+
+    // LOB ロケータ列を OracleLobReader で読む（NULL は validity に落とす）
+    void ReadLobColumn(dpiData *data, idx_t count, Vector &result, idx_t offset);
+
+    // インラインに収まらなかった行をロケータから読んで埋める
+    void FillLobFallbacks(uint32_t start, idx_t count, DataChunk &output, idx_t offset);
+
+    // 変換した区間を辞書に積む。辞書が溢れたら残りを通常の変換で書く
+    void AppendDictionary(OracleDictionaryColumn &dict, dpiData *data, idx_t count,
+                          Vector &result, idx_t offset);
+
+    // 直前の往復の所要時間から次の往復の行数を決める
+    void AdaptFetchRows(std::chrono::steady_clock::duration elapsed, uint32_t rows);
+
+    // 直前の往復で受け取ったバッファの大きさ（バイト）
+    idx_t MeasureBatchBytes(uint32_t rows) const;
+
+    OracleConnection &conn_;
+    dpiStmt *stmt_ = nullptr;
+    std::vector<LogicalType> types_;
+    std::vector<OracleColumnConverter> converters_;  // 列ごとの変換カーネル
+    std::vector<OracleLobFallback>     lob_fallbacks_;
+    std::vector<idx_t>                 dictionary_columns_;  // 辞書化を試す出力列
+    std::vector<unique_ptr<OracleDictionaryColumn>> dictionaries_;
+    OracleLobReader                    lob_reader_;
+    uint32_t num_cols_ = 0;
+    bool     done_ = false;
+
+    // ─── フェッチ配列 ──────────────────────────────────────────────────────────
+    OracleFetchSizing      sizing_;
+    uint32_t               array_size_ = 0;  // define した配列長（確保済みの上限）
+    OracleMemoryReservation reservation_;    // define バッファ分の予約
+    uint32_t               fetch_rows_ = 0;  // 1 往復あたりの行数（<= array_size_）
+    idx_t                  fetch_count_ = 0;
+    std::chrono::steady_clock::duration min_rtt_ = std::chrono::steady_clock::duration::max();
+    std::vector<dpiVar *>  vars_;      // 列ごとの define 変数（出力列、ロケータ列の順）
+    std::vector<dpiData *> var_data_;  // vars_ の dpiData 配列
+    uint32_t buffer_index_ = 0;        // fetchRows が返したバッファ先頭行
+    uint32_t buffer_rows_  = 0;        // バッファ内の行数
+    uint32_t buffer_pos_   = 0;        // うち消費済みの行数
+    int      more_rows_    = 1;
+};
+
+} // namespace duckdb
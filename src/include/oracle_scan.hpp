@@ -3,23 +3,98 @@
 #include "duckdb.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "oracle_connection.hpp"
+#include "oracle_io_executor.hpp"
+#include "oracle_query.hpp"
 #include "oracle_type_mapping.hpp"
+#include <atomic>
 
 namespace duckdb {
 
+class OracleNumberNarrowing;
+
+// ───────────────────────────────────────────────────────────────────────────────
+// スキャンタスク: 1 タスク = 1 本の SELECT（1 カーソル）
+// ───────────────────────────────────────────────────────────────────────────────
+struct OracleScanTask {
+    // ROWID 範囲 [rowid_lo, rowid_hi)
+    std::string rowid_lo;  // 空文字 = 先頭
+    std::string rowid_hi;  // 空文字 = 末尾
+
+    // PARTITION (...) / SUBPARTITION (...) 指定
+    std::string partition;
+    bool        is_subpartition = false;
+
+    // 主キー範囲 [key_lo, key_hi)（SQL リテラル。空文字 = 下限 / 上限なし）
+    std::string key_lo;
+    std::string key_hi;
+    bool        key_range = false;
+
+    // ORA_HASH(hash_key, hash_buckets - 1) = hash_bucket（hash_buckets = 0 なら無効）
+    idx_t       hash_bucket  = 0;
+    idx_t       hash_buckets = 0;
+
+    idx_t       bytes = 0; // 見積りサイズ
+    bool        done = false;
+};
+
+// ───────────────────────────────────────────────────────────────────────────────
+// パーティション刈り込み用の単純述語: column <comparison> constant
+// ───────────────────────────────────────────────────────────────────────────────
+struct OracleColumnPredicate {
+    std::string    column;      // Oracle カラム名
+    ExpressionType comparison;  // COMPARE_EQUAL / COMPARE_LESSTHAN / ...
+    Value          constant;
+};
+
 // ───────────────────────────────────────────────────────────────────────────────
 // スキャン Bind データ
 // ───────────────────────────────────────────────────────────────────────────────
 struct OracleScanBindData : public FunctionData {
     std::shared_ptr<OracleConnectionPool> pool;
+    optional_ptr<OracleIOExecutor>        io_executor;  // カタログが所有
+    optional_ptr<OracleMemoryBudget>      memory_budget; // カタログが所有
+    // 整数化した NUMBER 列があるときだけ設定（カタログが所有）
+    optional_ptr<OracleNumberNarrowing>   number_narrowing;
 
     std::string schema;
     std::string table;
     std::vector<OracleColumnInfo> all_columns;  // テーブル全カラム
     std::vector<LogicalType>      all_types;
 
+    // パーティション表のセグメント一覧（Bind 時に取得。非パーティション表は空）
+    // フィルタで刈り込まれたパーティションはここから取り除かれる
+    OraclePartitionScheme            partition_scheme;
+    std::vector<OraclePartitionInfo> partitions;
+
     // Pushdown されたフィルタ
     std::vector<std::string> filters;           // WHERE 句に追加する SQL 断片
+    std::vector<OracleColumnPredicate> predicates; // うち刈り込みに使える単純比較
+
+    bool IsPartitioned() const { return !partition_scheme.type.empty(); }
+
+    // ROWID 範囲分割できないビュー / IOT はハッシュバケットで分割する
+    OracleTableKind table_kind = OracleTableKind::HEAP_TABLE;
+    std::string     hash_key;   // ORA_HASH に渡す SQL 式（空 = バケット分割しない）
+
+    // 数値 / 日付の単一列主キー（空 = キー範囲分割しない）
+    std::string     range_key;
+
+    // この長さ以下の LOB はインラインで受け取る（0 = 常にロケータ）
+    idx_t           lob_inline_size = 0;
+
+    // all_columns と同じ並び。SELECT リストで列を包む変換関数
+    // （"TO_BINARY_DOUBLE" 等。空文字 = そのまま、空 = 変換する列なし）
+    std::vector<std::string> server_casts;
+
+    // all_columns と同じ並び。NUM_DISTINCT の少ない文字列列（空 = なし）
+    std::vector<bool> dictionary_columns;
+
+    // 空間索引のある SDO_GEOMETRY 列名 → SRID の SQL 表記（"NULL" または数値）。
+    // ここにある列だけ SDO_FILTER を pushdown できる
+    std::unordered_map<std::string, std::string> spatial_srids;
+
+    // ALL_TABLES.AVG_ROW_LEN（フェッチ配列の大きさの目安。0 = 統計なし）
+    idx_t           avg_row_len = 0;
 
     // Projection Pushdown: スキャンするカラムインデックス
     std::vector<column_t> column_ids;
@@ -30,40 +105,116 @@ struct OracleScanBindData : public FunctionData {
 
     int oracle_major_version = 12; // FETCH FIRST vs ROWNUM
 
+    // CONSISTENT_SNAPSHOT: 全ワーカー・全テーブルを AS OF SCN でこの時点にそろえる（0 = 無効）
+    uint64_t snapshot_scn = 0;
+
     unique_ptr<FunctionData> Copy() const override;
     bool Equals(const FunctionData &other) const override;
 
-    // 実行する SELECT 文を組み立てる
-    std::string BuildSelectQuery() const;
+    // 実行する SELECT 文を組み立てる（task が指定されればその範囲に限定）
+    std::string BuildSelectQuery(const OracleScanTask *task = nullptr) const;
+
+    // column_ids に対応する出力列の型
+    std::vector<LogicalType> GetProjectedTypes() const;
+
+    // 射影する列の定義上の幅と AVG_ROW_LEN から 1 行の大きさを見積もる
+    OracleFetchSizing GetFetchSizing() const;
+
+    // インラインで受け取る LOB 列と、BuildSelectQuery が末尾に足すロケータ列
+    std::vector<OracleLobFallback> GetLobFallbacks() const;
+
+    // 辞書ベクトルで返す出力列の位置
+    std::vector<idx_t> GetDictionaryColumns() const;
 };
 
 // ───────────────────────────────────────────────────────────────────────────────
 // グローバルステート（並列スキャン用）
 // ───────────────────────────────────────────────────────────────────────────────
 struct OracleScanGlobalState : public GlobalTableFunctionState {
-    explicit OracleScanGlobalState(const OracleScanBindData &bind_data);
+    OracleScanGlobalState(ClientContext &context, const OracleScanBindData &bind_data);
+
+    // ROWID 範囲 / パーティション / キー範囲 / ハッシュバケットごとのタスクリスト
+    using ScanTask = OracleScanTask;
 
-    // ROWID 範囲ごとのタスクリスト
-    struct ScanTask {
-        std::string rowid_lo;  // 空文字 = 先頭
-        std::string rowid_hi;  // 空文字 = 末尾
-        bool        done = false;
+    // ワーカーが受け持つタスク列 tasks[next, end)。
+    // 持ち主は先頭から 1 つずつ取り、手の空いたワーカーは後半を奪う
+    struct WorkRange {
+        std::mutex         lock;
+        std::atomic<idx_t> next{0};
+        std::atomic<idx_t> end{0};
+
+        idx_t Remaining() const {
+            idx_t n = next.load(std::memory_order_relaxed);
+            idx_t e = end.load(std::memory_order_relaxed);
+            return e > n ? e - n : 0;
+        }
     };
 
-    std::vector<ScanTask> tasks;
-    idx_t        next_task = 0;
-    std::mutex   mutex;
+    std::vector<ScanTask>               tasks;
+    std::vector<unique_ptr<WorkRange>>  ranges;
+    std::atomic<idx_t>                  next_range{0}; // まだ誰も持っていない範囲の先頭
     idx_t        max_threads;
 
     idx_t MaxThreads() const override { return max_threads; }
+
+    // 次に実行するタスクを取り出す。range はワーカーが現在持つ範囲の番号
+    // （最初は INVALID_INDEX）。自分の範囲が尽きたら未着手の範囲を取り、
+    // それもなければ他のワーカーの残りを半分奪う。何も残っていなければ false
+    bool NextTask(idx_t &range, ScanTask &task);
+
+private:
+    // tasks を ranges に割り振る。連続した範囲のタスク（ROWID / キー範囲）は
+    // スレッドごとにまとめ、それ以外は 1 タスク 1 範囲にする
+    void BuildRanges(idx_t num_threads);
+
+    // 残りが最も多い範囲の後半を own に移す。奪えるものがなければ false
+    bool Steal(idx_t own);
+
+    // tasks が隣り合う範囲を順に並べたものか（まとめて割り当てると局所性がよい）
+    bool contiguous_tasks = false;
+
+    // パーティション / サブパーティションごとにタスクを作る。大きなものは
+    // エクステントから ROWID 範囲のサブタスクに分ける
+    void PlanPartitionTasks(const OracleScanBindData &bind_data, OracleConnection &conn,
+                            idx_t num_threads);
+
+    // 連続したエクステントを task_bytes ごとの ROWID 範囲にまとめ、base の
+    // 指定（パーティション）を引き継いだタスクとして足す
+    void AppendExtentTasks(const ScanTask &base, const std::vector<OracleExtentInfo> &extents,
+                           idx_t task_bytes);
+
+    // 主キーの値域をヒストグラム（なければサンプル）で区切ってタスクを作る
+    void PlanKeyRangeTasks(const OracleScanBindData &bind_data, OracleConnection &conn,
+                           idx_t num_threads);
+
+    // ORA_HASH(hash_key, N-1) の値ごとにタスクを作る
+    void PlanHashTasks(const OracleScanBindData &bind_data, OracleConnection &conn,
+                       idx_t num_threads);
+
+    // エクステント情報からテーブルを ROWID 範囲に分割する
+    void PlanRowidTasks(const OracleScanBindData &bind_data, OracleConnection &conn,
+                        idx_t num_threads);
 };
 
 // ───────────────────────────────────────────────────────────────────────────────
 // ローカルステート（スレッドごと）
 // ───────────────────────────────────────────────────────────────────────────────
 struct OracleScanLocalState : public LocalTableFunctionState {
-    std::shared_ptr<OracleConnection> connection;
-    DataChunk  current_chunk;
+    ~OracleScanLocalState() override;
+
+    std::shared_ptr<OracleConnectionPool> pool;
+    std::shared_ptr<OracleConnection>     connection;
+
+    // Scan 呼び出しをまたいで開いたままにするカーソル
+    unique_ptr<OracleQueryCursor> cursor;
+    // PREFETCH_CHUNKS > 0 なら、cursor を使ったフェッチは I/O スレッドが行う
+    std::shared_ptr<OracleIOStream> stream;
+    bool prefetching = false;
+    std::vector<LogicalType>      projected_types;
+    OracleFetchSizing             fetch_sizing;
+    std::vector<OracleLobFallback> lob_fallbacks;
+    std::vector<idx_t>            dictionary_columns;
+    idx_t      work_range = DConstants::INVALID_INDEX;  // 受け持ち中の WorkRange
     bool       done = false;
 };
 
@@ -90,10 +241,18 @@ public:
     static void Scan(ClientContext &context, TableFunctionInput &data,
                      DataChunk &output);
 
+    // タスクを順に取りながら output を埋める。担当分が尽きたら false
+    static bool FillChunk(const OracleScanBindData &bind_data,
+                          OracleScanGlobalState &global_state,
+                          OracleScanLocalState &local, DataChunk &output);
+
     // Cardinality ヒント
     static unique_ptr<NodeStatistics>
         Cardinality(ClientContext &context, const FunctionData *bind_data);
 
+    // EXPLAIN に表示する情報（Oracle に送る SELECT 文）
+    static InsertionOrderPreservingMap<string> ToString(TableFunctionToStringInput &input);
+
     // Pushdown コールバック
     static void ComplexFilter(ClientContext &context,
                                LogicalGet &get,
@@ -41,6 +41,8 @@ private:
 
     // テーブル名 → CatalogEntry のローカルキャッシュ
     unordered_map<string, unique_ptr<CatalogEntry>> table_cache_;
+    // 読み直しで置き換えたエントリ（参照が残っている可能性があるので解放しない）
+    vector<unique_ptr<CatalogEntry>> retired_tables_;
     mutex cache_mutex_;
 
     optional_ptr<CatalogEntry> GetOrLoadTable(const string &table_name);
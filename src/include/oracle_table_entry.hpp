@@ -4,9 +4,26 @@
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "oracle_connection.hpp"
 #include "oracle_type_mapping.hpp"
+#include <mutex>
 
 namespace duckdb {
 
+// ───────────────────────────────────────────────────────────────────────────────
+// OracleTableScanMetadata: バインドごとに変わらない辞書情報
+// （初回のバインドで取得し、エントリが読み直されるまで使い回す）
+// ───────────────────────────────────────────────────────────────────────────────
+struct OracleTableScanMetadata {
+    int                              oracle_major_version = 12;
+    OracleTableKind                  table_kind = OracleTableKind::HEAP_TABLE;
+    idx_t                            avg_row_len = 0;
+    OraclePartitionScheme            partition_scheme;
+    std::vector<OraclePartitionInfo> partitions;
+    std::string                      hash_key;
+    std::string                      range_key;
+    std::vector<bool>                dictionary_columns;
+    std::unordered_map<std::string, std::string> spatial_srids;
+};
+
 // ───────────────────────────────────────────────────────────────────────────────
 // OracleTableEntry
 // ───────────────────────────────────────────────────────────────────────────────
@@ -32,9 +49,20 @@ public:
         return oracle_columns_;
     }
 
+    // 統計から整数化した NUMBER 列があるか
+    bool HasNarrowedColumns() const;
+
 private:
     OracleConnectionPool &pool_;
     std::vector<OracleColumnInfo> oracle_columns_;
+
+    // スキャン用の辞書情報（nullptr = 未取得）。ClearCache や整数化の取り消しで
+    // エントリごと作り直されるので、明示的に無効化する必要はない
+    unique_ptr<OracleTableScanMetadata> scan_metadata_;
+    std::mutex scan_metadata_mutex_;
+
+    unique_ptr<OracleTableScanMetadata> LoadScanMetadata(OracleConnection &conn,
+                                                         const std::vector<LogicalType> &types);
 };
 
 // テーブル情報を Oracle から読み取って CreateTableInfo を構築する
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "duckdb.hpp"
+#include "duckdb/common/exception.hpp"
 #include "duckdb/common/types.hpp"
 #include <dpi.h>
 
@@ -16,11 +17,74 @@ struct OracleColumnInfo {
     int32_t     scale     = -127;   // NUMBER(p,s) の s (-127 = 未指定)
     int32_t     char_length = 0;    // VARCHAR2(n) の n
     bool        nullable = true;
+    uint32_t    vector_dimensions = 0;  // VECTOR(n, ...) の n（0 = 可変）
+    uint8_t     vector_format = 0;      // DPI_VECTOR_FORMAT_*（0 = 可変）
+    std::string json_schema;            // JSON 列を展開する DuckDB 型（空 = JSON テキスト）
+    // 精度なし NUMBER を統計から整数と判定した（precision は推定値、scale は 0）
+    bool        narrowed = false;
 
     // ODPI-C クエリ情報から生成
     static OracleColumnInfo FromQueryInfo(const dpiQueryInfo &info, const std::string &name);
 };
 
+// ───────────────────────────────────────────────────────────────────────────────
+// OracleNarrowingException: 統計から整数化した NUMBER 列（NUMBER_NARROWING）に
+// 小数・桁あふれの値が来た。ほかの変換エラーと区別して整数化だけを取り消す
+// ───────────────────────────────────────────────────────────────────────────────
+class OracleNarrowingException : public ConversionException {
+public:
+    template <typename... ARGS>
+    explicit OracleNarrowingException(const string &msg, ARGS... params)
+        : ConversionException(msg, params...) {}
+};
+
+// ───────────────────────────────────────────────────────────────────────────────
+// OracleColumnConverter: 列ごとに 1 度だけ選ぶ変換カーネル
+//
+// (Oracle 型, native 型, DuckDB LogicalType) の組からカーソルを開いた時点で
+// カーネルを決め、以降は Value を経由せず FlatVector に直接書き込む。
+// ───────────────────────────────────────────────────────────────────────────────
+struct OracleColumnConverter;
+
+// 連続した dpiData 配列 data[0..count) を result[offset..] に書き込む
+typedef void (*oracle_convert_function_t)(const OracleColumnConverter &conv,
+                                          dpiData *data, idx_t count,
+                                          Vector &result, idx_t offset);
+
+struct OracleColumnConverter {
+    dpiOracleTypeNum oracle_type = DPI_ORACLE_TYPE_NONE;
+    dpiNativeTypeNum native_type = DPI_NATIVE_TYPE_BYTES;
+    LogicalType      type;
+    oracle_convert_function_t convert = nullptr;
+
+    // dpiConn_newVar / dpiStmt_define に渡す型とバッファサイズ（バイト）
+    dpiOracleTypeNum define_type = DPI_ORACLE_TYPE_NONE;
+    uint32_t         define_size = 0;
+
+    // true ならロケータをカーソルが OracleLobReader で読む（convert は使わない）
+    bool stream_lob = false;
+
+    // true なら CHAR の末尾の空白を落とす（EnableBlankTrim で立つ）
+    bool trim_blanks = false;
+
+    // クエリ情報とターゲット型からカーネルを選ぶ
+    static OracleColumnConverter Create(const dpiDataTypeInfo &info,
+                                        const LogicalType &type);
+
+    // CHAR / NCHAR なら末尾の空白を落とすカーネルに切り替える（TRIM_CHAR）
+    void EnableBlankTrim();
+
+    // CLOB / NCLOB / BLOB 列を LONG / LONG RAW で define し、値を行と一緒に受け取る
+    static OracleColumnConverter CreateInlineLob(const dpiDataTypeInfo &info,
+                                                 const LogicalType &type,
+                                                 uint32_t inline_bytes);
+
+    // フェッチ配列の 1 区間を列方向に変換する
+    void Convert(dpiData *data, idx_t count, Vector &result, idx_t offset) const {
+        convert(*this, data, count, result, offset);
+    }
+};
+
 // ───────────────────────────────────────────────────────────────────────────────
 // 型マッピング
 // ───────────────────────────────────────────────────────────────────────────────
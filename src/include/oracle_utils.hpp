@@ -21,7 +21,49 @@ struct OracleConnectionParameters {
     std::string wallet_location;    // SSL/TLS ウォレットパス
     std::string schema;             // ATTACHするスキーマ (未指定=user)
     bool        read_only = false;
-    int         fetch_size = 10000; // 一度に取得する行数
+    bool        trim_char = false;    // CHAR / NCHAR の末尾の空白を落とす
+    // NUM_DISTINCT がこれ以下の文字列列は辞書ベクトルで返す（0 = 使わない）
+    int         dictionary_threshold = 100;
+    int         fetch_size = 0;       // 1 往復の行数を固定する場合の値（0 = 自動）
+    int         fetch_buffer_mb = 16; // カーソルごとのフェッチバッファ上限
+    int         prefetch_chunks = 2;  // ワーカーごとに先読みするチャンク数（0 = 先読みしない）
+    int         io_threads = 4;       // 先読みを実行する I/O スレッド数（データベースごと）
+    // フェッチバッファと先読みチャンクの合計上限（0 = DuckDB の memory_limit の 1/4）
+    int         memory_budget_mb = 0;
+
+    // この長さ以下の CLOB / NCLOB / BLOB は LONG / LONG RAW としてフェッチ配列に
+    // 直接受け取る（CLOB は文字数、BLOB はバイト数。0 = 常にロケータ）
+    int         lob_inline_size = 32768;
+    // テーブル名（"SCHEMA.TABLE" または "TABLE"、大文字）→ lob_inline_size
+    std::unordered_map<std::string, int> lob_inline_sizes;
+
+    // NUMBER 列をサーバー側で BINARY_DOUBLE / BINARY_FLOAT に変換して受け取る範囲:
+    // NONE / FLOAT（DOUBLE / FLOAT になる列）/ ALL（15 桁以下の整数列も）
+    std::string number_coercion = "NONE";
+    // 列名（"SCHEMA.TABLE.COLUMN" または "TABLE.COLUMN"、大文字）→ number_coercion
+    std::unordered_map<std::string, std::string> number_coercions;
+
+    // 精度なし NUMBER 列を統計から整数と判定できれば BIGINT / HUGEINT にする
+    bool        number_narrowing = false;
+
+    // JSON 列を展開する DuckDB 型。列名（"SCHEMA.TABLE.COLUMN" または
+    // "TABLE.COLUMN"、大文字）→ 型名（"STRUCT(id BIGINT, tags VARCHAR[])" 等）
+    std::unordered_map<std::string, std::string> json_schemas;
+
+    // トランザクション開始時の SCN で全 SELECT を AS OF SCN にそろえる
+    bool        consistent_snapshot = false;
+
+    // ─── 並列スキャン ──────────────────────────────────────────────────────────
+    int         max_threads = 0;              // 0 = DuckDB のスレッド数
+    int         task_size_mb = 128;           // ROWID 範囲タスク 1 つあたりの目安
+    int         parallel_threshold_mb = 256;  // これ未満のテーブルは単一スレッド
+    // 表の分割方法: AUTO（表は ROWID、IOT は主キー範囲）/ ROWID / KEY（主キー範囲を優先）
+    std::string parallel_strategy = "AUTO";
+
+    // ROWID を使えないビュー / IOT は ORA_HASH(キー, N-1) = k でバケット分割する
+    int         hash_buckets = 0;             // N（0 = スレッド数）
+    // テーブル名（"SCHEMA.TABLE" または "TABLE"、大文字）→ キー列（カンマ区切り）
+    std::unordered_map<std::string, std::string> hash_keys;
 
     // "host=... port=... service=... user=... password=..." 形式をパース
     static OracleConnectionParameters ParseConnectionString(const std::string &conn_str);
@@ -51,6 +93,9 @@ public:
     // 文字列を大文字に変換（Oracle はデフォルト大文字）
     static std::string ToUpper(const std::string &s);
 
+    // 前後の空白を取り除く
+    static std::string Trim(const std::string &s);
+
     // キーバリュー文字列をパース ("key=val key2='val 2'")
     static std::unordered_map<std::string, std::string>
         ParseKeyValueString(const std::string &s);
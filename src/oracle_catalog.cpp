@@ -4,6 +4,7 @@
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/parser/parsed_data/attach_info.hpp"
 #include "duckdb/parser/parsed_data/create_schema_info.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
 
@@ -13,12 +14,22 @@ OracleCatalog::OracleCatalog(AttachedDatabase &db,
                                const OracleConnectionParameters &params)
     : Catalog(db), params_(params) {
     pool_ = make_uniq<OracleConnectionPool>(params_, /*max=*/8);
+    auto &buffer_manager = BufferManager::GetBufferManager(db.GetDatabase());
+    idx_t budget = params_.memory_budget_mb > 0
+                       ? (idx_t)params_.memory_budget_mb * 1024 * 1024
+                       : buffer_manager.GetMaxMemory() / 4;
+    memory_budget_ = make_uniq<OracleMemoryBudget>(buffer_manager, budget);
+    io_executor_ = make_uniq<OracleIOExecutor>((idx_t)MaxValue<int>(params_.io_threads, 1));
 }
 
 OracleCatalog::~OracleCatalog() = default;
 
 // ─── Attach コールバック ──────────────────────────────────────────────────────
 
+static bool IsNumberCoercion(const std::string &mode) {
+    return mode == "NONE" || mode == "FLOAT" || mode == "ALL";
+}
+
 unique_ptr<Catalog>
 OracleCatalog::Attach(StorageExtensionInfo *info, ClientContext &context,
                        AttachedDatabase &db, const string &name,
@@ -31,8 +42,81 @@ OracleCatalog::Attach(StorageExtensionInfo *info, ClientContext &context,
     for (auto &opt : attach_info.options) {
         if (opt.first == "schema") {
             params.schema = opt.second.GetValue<string>();
+        } else if (opt.first == "dictionary_threshold") {
+            params.dictionary_threshold = (int)opt.second.GetValue<int64_t>();
+        } else if (opt.first == "trim_char") {
+            params.trim_char = opt.second.GetValue<bool>();
         } else if (opt.first == "fetch_size") {
             params.fetch_size = (int)opt.second.GetValue<int64_t>();
+        } else if (opt.first == "fetch_buffer_mb") {
+            params.fetch_buffer_mb = (int)opt.second.GetValue<int64_t>();
+        } else if (opt.first == "lob_inline_size") {
+            params.lob_inline_size = (int)opt.second.GetValue<int64_t>();
+        } else if (opt.first == "lob_inline_sizes") {
+            // 'HR.DOCS=1048576 AUDIT_LOG=0'
+            auto kv = OracleUtils::ParseKeyValueString(opt.second.GetValue<string>());
+            for (auto &entry : kv) {
+                params.lob_inline_sizes[OracleUtils::ToUpper(entry.first)] =
+                    std::stoi(entry.second);
+            }
+        } else if (opt.first == "number_narrowing") {
+            params.number_narrowing = opt.second.GetValue<bool>();
+        } else if (opt.first == "number_coercion") {
+            params.number_coercion = OracleUtils::ToUpper(opt.second.GetValue<string>());
+            if (!IsNumberCoercion(params.number_coercion)) {
+                throw BinderException("NUMBER_COERCION must be NONE, FLOAT or ALL");
+            }
+        } else if (opt.first == "number_coercions") {
+            // 'HR.EMPLOYEES.SALARY=NONE SALES.AMOUNT=FLOAT'
+            auto kv = OracleUtils::ParseKeyValueString(opt.second.GetValue<string>());
+            for (auto &entry : kv) {
+                auto mode = OracleUtils::ToUpper(entry.second);
+                if (!IsNumberCoercion(mode)) {
+                    throw BinderException("NUMBER_COERCIONS: " + entry.first +
+                                          " must be NONE, FLOAT or ALL");
+                }
+                params.number_coercions[OracleUtils::ToUpper(entry.first)] = mode;
+            }
+        } else if (opt.first == "json_schemas") {
+            // 'APP.ORDERS.DOC=''STRUCT(id BIGINT, items VARCHAR[])'''
+            auto kv = OracleUtils::ParseKeyValueString(opt.second.GetValue<string>());
+            for (auto &entry : kv) {
+                try {
+                    TransformStringToLogicalType(entry.second);
+                } catch (const std::exception &) {
+                    throw BinderException("JSON_SCHEMAS: " + entry.first +
+                                          " has an invalid type \"" + entry.second + "\"");
+                }
+                params.json_schemas[OracleUtils::ToUpper(entry.first)] = entry.second;
+            }
+        } else if (opt.first == "prefetch_chunks") {
+            params.prefetch_chunks = (int)opt.second.GetValue<int64_t>();
+        } else if (opt.first == "memory_budget_mb") {
+            params.memory_budget_mb = (int)opt.second.GetValue<int64_t>();
+        } else if (opt.first == "io_threads") {
+            params.io_threads = (int)opt.second.GetValue<int64_t>();
+        } else if (opt.first == "consistent_snapshot") {
+            params.consistent_snapshot = opt.second.GetValue<bool>();
+        } else if (opt.first == "max_threads") {
+            params.max_threads = (int)opt.second.GetValue<int64_t>();
+        } else if (opt.first == "task_size_mb") {
+            params.task_size_mb = (int)opt.second.GetValue<int64_t>();
+        } else if (opt.first == "parallel_threshold_mb") {
+            params.parallel_threshold_mb = (int)opt.second.GetValue<int64_t>();
+        } else if (opt.first == "parallel_strategy") {
+            params.parallel_strategy = OracleUtils::ToUpper(opt.second.GetValue<string>());
+            if (params.parallel_strategy != "AUTO" && params.parallel_strategy != "ROWID" &&
+                params.parallel_strategy != "KEY") {
+                throw BinderException("PARALLEL_STRATEGY must be AUTO, ROWID or KEY");
+            }
+        } else if (opt.first == "hash_buckets") {
+            params.hash_buckets = (int)opt.second.GetValue<int64_t>();
+        } else if (opt.first == "hash_keys") {
+            // 'HR.EMP_V=EMPLOYEE_ID ORDERS_V=ORDER_ID,LINE_NO'
+            auto kv = OracleUtils::ParseKeyValueString(opt.second.GetValue<string>());
+            for (auto &entry : kv) {
+                params.hash_keys[OracleUtils::ToUpper(entry.first)] = entry.second;
+            }
         }
     }
 
@@ -139,15 +223,64 @@ void OracleCatalog::ClearCache() {
         schema_cache_.clear();
     }
     pool_->ClearCache();
+    // 統計が更新されているかもしれないので整数化も判定し直す
+    number_narrowing_.Clear();
     // デフォルトスキーマを再ロード
     PreloadSchema(params_.GetEffectiveSchema());
 }
 
+// ─── OracleNumberNarrowing ────────────────────────────────────────────────────
+
+bool OracleNumberNarrowing::Get(const std::string &table_key, columns_t &columns) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    auto it = tables_.find(table_key);
+    if (it == tables_.end()) return false;
+    columns = it->second;
+    return true;
+}
+
+void OracleNumberNarrowing::Set(const std::string &table_key, columns_t columns) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    tables_[table_key] = std::move(columns);
+}
+
+void OracleNumberNarrowing::Reject(const std::string &table_key) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    tables_[table_key].clear();
+}
+
+void OracleNumberNarrowing::Clear() {
+    std::lock_guard<std::mutex> lk(mutex_);
+    tables_.clear();
+}
+
 // ─── OracleTransaction ────────────────────────────────────────────────────────
 
 OracleTransaction::OracleTransaction(TransactionManager &manager,
-                                       ClientContext &context)
-    : Transaction(manager, context) {}
+                                       ClientContext &context, OracleCatalog &catalog)
+    : Transaction(manager, context),
+      consistent_snapshot_(catalog.GetConnectionPool().GetParams().consistent_snapshot) {}
+
+uint64_t OracleTransaction::GetSnapshotSCN(OracleConnection &conn, const std::string &schema,
+                                           const std::string &table) {
+    std::lock_guard<std::mutex> lk(snapshot_mutex_);
+    if (!consistent_snapshot_ || snapshot_resolved_) {
+        return snapshot_scn_;
+    }
+    // 以降このトランザクションで生成する SELECT はすべてこの時点を読む。
+    // SCN を取得できない、または AS OF で読めない（権限なし等）なら、タスクごとに
+    // 時点が混ざらないよう最初から全文を各文の時点で読む
+    snapshot_scn_ = conn.GetCurrentSCN();
+    if (snapshot_scn_ != 0 && !conn.CanReadAsOf(schema, table, snapshot_scn_)) {
+        snapshot_scn_ = 0;
+    }
+    snapshot_resolved_ = true;
+    return snapshot_scn_;
+}
+
+OracleTransaction &OracleTransaction::Get(ClientContext &context, Catalog &catalog) {
+    return Transaction::Get(context, catalog).Cast<OracleTransaction>();
+}
 
 // ─── OracleTransactionManager ────────────────────────────────────────────────
 
@@ -163,7 +296,7 @@ OracleTransactionManager::Create(StorageExtensionInfo *info,
 }
 
 Transaction &OracleTransactionManager::StartTransaction(ClientContext &context) {
-    auto transaction = make_uniq<OracleTransaction>(*this, context);
+    auto transaction = make_uniq<OracleTransaction>(*this, context, catalog_);
     auto &result = *transaction;
     lock_guard<mutex> l(transaction_lock);
     transactions[result] = std::move(transaction);
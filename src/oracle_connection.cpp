@@ -1,7 +1,9 @@
 #include "oracle_connection.hpp"
+#include "oracle_query.hpp"
 #include "duckdb/common/exception.hpp"
 #include <sstream>
 #include <stdexcept>
+#include <unordered_map>
 
 namespace duckdb {
 
@@ -188,115 +190,627 @@ OracleConnection::GetColumns(const std::string &schema, const std::string &table
     }
 
     dpiStmt_release(stmt);
+
+    // VECTOR の次元数と形式は ALL_TAB_COLUMNS にないので、列を describe して取る
+    std::vector<OracleColumnInfo *> vectors;
+    std::string select;
+    for (auto &col : columns) {
+        if (col.oracle_type_name != "VECTOR") continue;
+        select += (vectors.empty() ? "SELECT " : ", ") + OracleUtils::QuoteIdentifier(col.name);
+        vectors.push_back(&col);
+    }
+    if (!vectors.empty()) {
+        select += " FROM " + OracleUtils::QuoteIdentifier(OracleUtils::ToUpper(schema)) + "." +
+                  OracleUtils::QuoteIdentifier(OracleUtils::ToUpper(table)) + " WHERE 1 = 0";
+        ThrowIfError(dpiConn_prepareStmt(conn_, 0, select.c_str(), (uint32_t)select.size(),
+                                         nullptr, 0, &stmt),
+                     "GetColumns::prepareStmt");
+        uint32_t num_cols = 0;
+        if (dpiStmt_execute(stmt, DPI_MODE_EXEC_DESCRIBE_ONLY, &num_cols) == DPI_SUCCESS) {
+            for (uint32_t i = 0; i < num_cols && i < vectors.size(); ++i) {
+                dpiQueryInfo info;
+                if (dpiStmt_getQueryInfo(stmt, i + 1, &info) != DPI_SUCCESS) continue;
+                vectors[i]->vector_dimensions = info.typeInfo.vectorDimensions;
+                vectors[i]->vector_format     = info.typeInfo.vectorFormat;
+            }
+        }
+        dpiStmt_release(stmt);
+    }
     return columns;
 }
 
-// ─── ExecuteQuery ─────────────────────────────────────────────────────────────
-
-void OracleConnection::ExecuteQuery(const std::string &sql,
-                                     const std::vector<LogicalType> &types,
-                                     idx_t fetch_size,
-                                     std::function<bool(DataChunk &)> callback) {
-    std::lock_guard<std::mutex> lk(mutex_);
+// ─── ForEachRow ───────────────────────────────────────────────────────────────
 
+void OracleConnection::ForEachRow(const std::string &sql, const std::string &context,
+                                  const std::function<void(dpiStmt *)> &row) {
     dpiStmt *stmt = nullptr;
     ThrowIfError(dpiConn_prepareStmt(conn_, 0, sql.c_str(), (uint32_t)sql.size(),
                                      nullptr, 0, &stmt),
-                 "ExecuteQuery::prepareStmt");
+                 context + "::prepareStmt");
+    try {
+        ThrowIfError(dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT, nullptr),
+                     context + "::execute");
+        int found = 0;
+        while (true) {
+            ThrowIfError(dpiStmt_fetch(stmt, &found, nullptr), context + "::fetch");
+            if (!found) break;
+            row(stmt);
+        }
+    } catch (...) {
+        dpiStmt_release(stmt);
+        throw;
+    }
+    dpiStmt_release(stmt);
+}
 
-    // fetch_size のプリフェッチ設定
-    dpiStmt_setFetchArraySize(stmt, (uint32_t)fetch_size);
+// 結果列の読み取りヘルパー
+static std::string QueryString(dpiStmt *stmt, uint32_t pos) {
+    dpiNativeTypeNum t;
+    dpiData *d;
+    dpiStmt_getQueryValue(stmt, pos, &t, &d);
+    if (d->isNull) return std::string();
+    return std::string(d->value.asBytes.ptr, d->value.asBytes.length);
+}
 
-    uint32_t num_cols = 0;
-    ThrowIfError(dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT, &num_cols),
-                 "ExecuteQuery::execute");
-
-    // 各カラムの native type を取得
-    std::vector<dpiQueryInfo> query_infos(num_cols);
-    std::vector<dpiNativeTypeNum> native_types(num_cols);
-    for (uint32_t i = 0; i < num_cols; ++i) {
-        dpiStmt_getQueryInfo(stmt, i + 1, &query_infos[i]);
-        // native type を選択
-        switch (query_infos[i].typeInfo.oracleTypeNum) {
-        case DPI_ORACLE_TYPE_NUMBER:
-            // 整数かどうかで分岐
-            if (query_infos[i].typeInfo.scale == 0 &&
-                query_infos[i].typeInfo.precision > 0 &&
-                query_infos[i].typeInfo.precision <= 18) {
-                native_types[i] = DPI_NATIVE_TYPE_INT64;
-            } else {
-                native_types[i] = DPI_NATIVE_TYPE_DOUBLE;
-            }
-            break;
-        case DPI_ORACLE_TYPE_NATIVE_FLOAT:
-            native_types[i] = DPI_NATIVE_TYPE_FLOAT;
-            break;
-        case DPI_ORACLE_TYPE_NATIVE_DOUBLE:
-            native_types[i] = DPI_NATIVE_TYPE_DOUBLE;
-            break;
-        case DPI_ORACLE_TYPE_DATE:
-        case DPI_ORACLE_TYPE_TIMESTAMP:
-        case DPI_ORACLE_TYPE_TIMESTAMP_TZ:
-        case DPI_ORACLE_TYPE_TIMESTAMP_LTZ:
-            native_types[i] = DPI_NATIVE_TYPE_TIMESTAMP;
-            break;
-        case DPI_ORACLE_TYPE_CLOB:
-        case DPI_ORACLE_TYPE_NCLOB:
-        case DPI_ORACLE_TYPE_BLOB:
-            native_types[i] = DPI_NATIVE_TYPE_LOB;
-            break;
-        case DPI_ORACLE_TYPE_INTERVAL_YM:
-            native_types[i] = DPI_NATIVE_TYPE_INTERVAL_YM;
-            break;
-        case DPI_ORACLE_TYPE_INTERVAL_DS:
-            native_types[i] = DPI_NATIVE_TYPE_INTERVAL_DS;
-            break;
-        default:
-            native_types[i] = DPI_NATIVE_TYPE_BYTES;
-            break;
+static double QueryNumber(dpiStmt *stmt, uint32_t pos) {
+    dpiNativeTypeNum t;
+    dpiData *d;
+    dpiStmt_getQueryValue(stmt, pos, &t, &d);
+    if (d->isNull) return 0;
+    return t == DPI_NATIVE_TYPE_INT64 ? (double)d->value.asInt64 : d->value.asDouble;
+}
+
+// ─── BreakExecution ───────────────────────────────────────────────────────────
+
+void OracleConnection::BreakExecution() {
+    // 実行中の呼び出しと並行して使うためのものなので mutex_ は取らない
+    dpiConn_breakExecution(conn_);
+}
+
+// ─── GetCurrentSCN ────────────────────────────────────────────────────────────
+
+uint64_t OracleConnection::GetCurrentSCN() {
+    std::lock_guard<std::mutex> lk(mutex_);
+    // SCN は double に収まらない可能性があるので文字列で受け取る
+    static const char *const queries[] = {
+        "SELECT TO_CHAR(CURRENT_SCN) FROM V$DATABASE",
+        "SELECT TO_CHAR(DBMS_FLASHBACK.GET_SYSTEM_CHANGE_NUMBER) FROM DUAL"};
+    for (const char *sql : queries) {
+        std::string scn;
+        try {
+            ForEachRow(sql, "GetCurrentSCN", [&](dpiStmt *stmt) {
+                scn = QueryString(stmt, 1);
+            });
+        } catch (const std::exception &) {
+            continue; // 権限がない
+        }
+        if (!scn.empty()) {
+            return std::stoull(scn);
         }
     }
+    return 0;
+}
 
-    // DataChunk を作成して行を詰める
-    DataChunk chunk;
-    chunk.Initialize(Allocator::DefaultAllocator(), types);
+// ─── CanReadAsOf ──────────────────────────────────────────────────────────────
 
-    int found = 0;
-    idx_t row_count = 0;
-    const idx_t CHUNK_SIZE = STANDARD_VECTOR_SIZE;
+static bool IsFlashbackError(const std::string &message) {
+    static const char *const codes[] = {"ORA-01031", "ORA-01466", "ORA-08180",
+                                        "ORA-08181", "ORA-01555"};
+    for (const char *code : codes) {
+        if (message.find(code) != std::string::npos) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool OracleConnection::CanReadAsOf(const std::string &schema, const std::string &table,
+                                   uint64_t scn) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    std::string sql = "SELECT 1 FROM " + OracleUtils::QuoteIdentifier(schema) + "." +
+                      OracleUtils::QuoteIdentifier(table) + " AS OF SCN " +
+                      std::to_string(scn) + " WHERE ROWNUM = 1";
+    try {
+        ForEachRow(sql, "CanReadAsOf", [](dpiStmt *) {});
+    } catch (const std::exception &e) {
+        if (IsFlashbackError(e.what())) {
+            return false;
+        }
+        throw;
+    }
+    return true;
+}
+
+// ─── GetTableKind ─────────────────────────────────────────────────────────────
+
+OracleTableKind
+OracleConnection::GetTableKind(const std::string &schema, const std::string &table,
+                               idx_t *avg_row_len) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    OracleTableKind kind = OracleTableKind::HEAP_TABLE;
+
+    std::string owner = OracleUtils::ToUpper(schema);
+    std::string name  = OracleUtils::ToUpper(table);
+    std::string sql =
+        "SELECT o.OBJECT_TYPE, t.IOT_TYPE, t.AVG_ROW_LEN "
+        "FROM ALL_OBJECTS o "
+        "LEFT JOIN ALL_TABLES t ON t.OWNER = o.OWNER AND t.TABLE_NAME = o.OBJECT_NAME "
+        "WHERE o.OWNER = '" + owner + "' AND o.OBJECT_NAME = '" + name + "' "
+        "  AND o.OBJECT_TYPE IN ('TABLE', 'VIEW')";
+    ForEachRow(sql, "GetTableKind", [&](dpiStmt *stmt) {
+        if (QueryString(stmt, 1) == "VIEW") {
+            kind = OracleTableKind::VIEW;
+        } else if (QueryString(stmt, 2) == "IOT") {
+            kind = OracleTableKind::IOT;
+        }
+        if (avg_row_len) {
+            *avg_row_len = (idx_t)QueryNumber(stmt, 3);
+        }
+    });
+    return kind;
+}
+
+// ─── GetPrimaryKeyColumns ─────────────────────────────────────────────────────
+
+std::vector<std::string>
+OracleConnection::GetPrimaryKeyColumns(const std::string &schema, const std::string &table) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    std::vector<std::string> columns;
+
+    std::string sql =
+        "SELECT cc.COLUMN_NAME "
+        "FROM ALL_CONSTRAINTS c "
+        "JOIN ALL_CONS_COLUMNS cc "
+        "  ON cc.OWNER = c.OWNER AND cc.CONSTRAINT_NAME = c.CONSTRAINT_NAME "
+        "WHERE c.OWNER = '" + OracleUtils::ToUpper(schema) + "' "
+        "  AND c.TABLE_NAME = '" + OracleUtils::ToUpper(table) + "' "
+        "  AND c.CONSTRAINT_TYPE = 'P' "
+        "ORDER BY cc.POSITION";
+    ForEachRow(sql, "GetPrimaryKeyColumns", [&](dpiStmt *stmt) {
+        columns.push_back(QueryString(stmt, 1));
+    });
+    return columns;
+}
+
+// ─── GetColumnDistinctCounts ──────────────────────────────────────────────────
+
+std::unordered_map<std::string, idx_t>
+OracleConnection::GetColumnDistinctCounts(const std::string &schema, const std::string &table) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    std::unordered_map<std::string, idx_t> counts;
+
+    std::string sql =
+        "SELECT COLUMN_NAME, NUM_DISTINCT "
+        "FROM ALL_TAB_COL_STATISTICS "
+        "WHERE OWNER = '" + OracleUtils::ToUpper(schema) + "' "
+        "  AND TABLE_NAME = '" + OracleUtils::ToUpper(table) + "' "
+        "  AND NUM_DISTINCT IS NOT NULL";
+    ForEachRow(sql, "GetColumnDistinctCounts", [&](dpiStmt *stmt) {
+        counts[QueryString(stmt, 1)] = (idx_t)QueryNumber(stmt, 2);
+    });
+    return counts;
+}
+
+// ─── GetSpatialIndexColumns ───────────────────────────────────────────────────
+
+std::unordered_map<std::string, std::string>
+OracleConnection::GetSpatialIndexColumns(const std::string &schema, const std::string &table) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    std::unordered_map<std::string, std::string> srids;
+
+    // SDO_FILTER は空間索引がないと使えない（ORA-13226）ので、索引のある列に限る
+    std::string sql =
+        "SELECT ic.COLUMN_NAME, TO_CHAR(m.SRID) "
+        "FROM ALL_INDEXES i "
+        "JOIN ALL_IND_COLUMNS ic "
+        "  ON ic.INDEX_OWNER = i.OWNER AND ic.INDEX_NAME = i.INDEX_NAME "
+        "LEFT JOIN ALL_SDO_GEOM_METADATA m "
+        "  ON m.OWNER = i.TABLE_OWNER AND m.TABLE_NAME = i.TABLE_NAME "
+        " AND m.COLUMN_NAME = ic.COLUMN_NAME "
+        "WHERE i.TABLE_OWNER = '" + OracleUtils::ToUpper(schema) + "' "
+        "  AND i.TABLE_NAME = '" + OracleUtils::ToUpper(table) + "' "
+        "  AND i.INDEX_TYPE = 'DOMAIN' "
+        "  AND i.ITYPE_OWNER = 'MDSYS' "
+        "  AND i.ITYPE_NAME LIKE 'SPATIAL_INDEX%'";
+    ForEachRow(sql, "GetSpatialIndexColumns", [&](dpiStmt *stmt) {
+        std::string srid = QueryString(stmt, 2);
+        srids[QueryString(stmt, 1)] = srid.empty() ? "NULL" : srid;
+    });
+    return srids;
+}
+
+// ─── GetIntegralNumberColumns ─────────────────────────────────────────────────
 
-    while (true) {
-        if (dpiStmt_fetch(stmt, &found, nullptr) != DPI_SUCCESS || !found) {
-            break;
+// TO_CHAR(NUMBER) の結果が整数ならその桁数、小数・指数表記なら 0
+static idx_t IntegralDigits(const std::string &text) {
+    idx_t digits = 0;
+    for (size_t i = 0; i < text.size(); ++i) {
+        char c = text[i];
+        if (c == '-' && i == 0) continue;
+        if (c < '0' || c > '9') return 0;
+        digits++;
+    }
+    return digits;
+}
+
+std::unordered_map<std::string, int32_t>
+OracleConnection::GetIntegralNumberColumns(const std::string &schema, const std::string &table) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    std::unordered_map<std::string, int32_t> result;
+
+    std::string owner = OracleUtils::ToUpper(schema);
+    std::string name  = OracleUtils::ToUpper(table);
+
+    // 1. 統計の最小値・最大値（内部形式の RAW）がどちらも整数か
+    std::string sql =
+        "SELECT s.COLUMN_NAME, "
+        "       TO_CHAR(UTL_RAW.CAST_TO_NUMBER(s.LOW_VALUE)), "
+        "       TO_CHAR(UTL_RAW.CAST_TO_NUMBER(s.HIGH_VALUE)) "
+        "FROM ALL_TAB_COL_STATISTICS s "
+        "JOIN ALL_TAB_COLUMNS c "
+        "  ON c.OWNER = s.OWNER AND c.TABLE_NAME = s.TABLE_NAME "
+        " AND c.COLUMN_NAME = s.COLUMN_NAME "
+        "WHERE s.OWNER = '" + owner + "' "
+        "  AND s.TABLE_NAME = '" + name + "' "
+        "  AND c.DATA_TYPE = 'NUMBER' "
+        "  AND c.DATA_PRECISION IS NULL AND c.DATA_SCALE IS NULL "
+        "  AND s.LOW_VALUE IS NOT NULL AND s.HIGH_VALUE IS NOT NULL";
+    std::vector<std::string> candidates;
+    ForEachRow(sql, "GetIntegralNumberColumns", [&](dpiStmt *stmt) {
+        idx_t low  = IntegralDigits(QueryString(stmt, 2));
+        idx_t high = IntegralDigits(QueryString(stmt, 3));
+        if (low == 0 || high == 0) return;
+        // 統計より大きな値が後から入っても収まるよう、15 桁までを BIGINT にする
+        idx_t digits = MaxValue(low, high);
+        if (digits > 35) return;
+        std::string column = QueryString(stmt, 1);
+        result[column] = digits <= 15 ? 18 : 38;
+        candidates.push_back(column);
+    });
+    if (candidates.empty()) return result;
+
+    // 2. 統計の後に入った小数を 1% の標本で確認する
+    std::string check = "SELECT ";
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        std::string col = OracleUtils::QuoteIdentifier(candidates[i]);
+        if (i > 0) check += ", ";
+        check += "MAX(CASE WHEN " + col + " <> TRUNC(" + col + ") THEN 1 ELSE 0 END)";
+    }
+    check += " FROM " + OracleUtils::QuoteIdentifier(owner) + "." +
+             OracleUtils::QuoteIdentifier(name) + " SAMPLE (1) WHERE ROWNUM <= 100000";
+    try {
+        ForEachRow(check, "GetIntegralNumberColumns", [&](dpiStmt *stmt) {
+            for (size_t i = 0; i < candidates.size(); ++i) {
+                if (QueryNumber(stmt, (uint32_t)i + 1) != 0) result.erase(candidates[i]);
+            }
+        });
+    } catch (const std::exception &) {
+        result.clear(); // 標本を取れない表は整数化しない
+    }
+    return result;
+}
+
+// ─── GetTableExtents ──────────────────────────────────────────────────────────
+
+std::vector<OracleExtentInfo>
+OracleConnection::GetTableExtents(const std::string &schema, const std::string &table) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    std::vector<OracleExtentInfo> extents;
+    ReadExtents(schema, table, false, [&](const std::string &, OracleExtentInfo ext) {
+        extents.push_back(std::move(ext));
+    });
+    return extents;
+}
+
+// ─── GetPartitionExtents ──────────────────────────────────────────────────────
+
+std::unordered_map<std::string, std::vector<OracleExtentInfo>>
+OracleConnection::GetPartitionExtents(const std::string &schema, const std::string &table) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    std::unordered_map<std::string, std::vector<OracleExtentInfo>> extents;
+    ReadExtents(schema, table, true, [&](const std::string &partition, OracleExtentInfo ext) {
+        extents[partition].push_back(std::move(ext));
+    });
+    return extents;
+}
+
+// ─── ReadExtents ──────────────────────────────────────────────────────────────
+
+void OracleConnection::ReadExtents(
+    const std::string &schema, const std::string &table, bool partitioned,
+    const std::function<void(const std::string &, OracleExtentInfo)> &row) {
+    std::string owner = OracleUtils::ToUpper(schema);
+    std::string name  = OracleUtils::ToUpper(table);
+
+    // パーティションのセグメントは SEGMENT_TYPE が TABLE (SUB)PARTITION で、
+    // オブジェクトとは SUBOBJECT_NAME = PARTITION_NAME で対応する
+    std::string segment_filter =
+        partitioned ? "IN ('TABLE PARTITION', 'TABLE SUBPARTITION') " : "= 'TABLE' ";
+    std::string object_filter =
+        partitioned ? " AND o.OBJECT_TYPE = e.SEGMENT_TYPE "
+                      " AND o.SUBOBJECT_NAME = e.PARTITION_NAME "
+                    : " AND o.OBJECT_TYPE = 'TABLE' ";
+
+    // 各エクステントを [先頭ブロックの行 0, 直後のブロックの行 0) の ROWID 範囲にする
+    auto build_sql = [&](const std::string &extents_view, const std::string &objects_view,
+                         const std::string &owner_filter) {
+        return "SELECT ROWIDTOCHAR(DBMS_ROWID.ROWID_CREATE(1, o.DATA_OBJECT_ID, "
+               "           e.RELATIVE_FNO, e.BLOCK_ID, 0)), "
+               "       ROWIDTOCHAR(DBMS_ROWID.ROWID_CREATE(1, o.DATA_OBJECT_ID, "
+               "           e.RELATIVE_FNO, e.BLOCK_ID + e.BLOCKS, 0)), "
+               "       e.BYTES, e.PARTITION_NAME "
+               "FROM " + extents_view + " e "
+               "JOIN " + objects_view + " o "
+               "  ON o.OBJECT_NAME = e.SEGMENT_NAME " + object_filter + owner_filter +
+               "WHERE e.SEGMENT_NAME = '" + name + "' "
+               "  AND e.SEGMENT_TYPE " + segment_filter +
+               (owner_filter.empty() ? "" : "  AND e.OWNER = '" + owner + "' ") +
+               "ORDER BY e.PARTITION_NAME, e.RELATIVE_FNO, e.BLOCK_ID";
+    };
+    std::vector<std::pair<std::string, OracleExtentInfo>> extents;
+    auto read_row = [&](dpiStmt *stmt) {
+        OracleExtentInfo ext;
+        ext.rowid_lo = QueryString(stmt, 1);
+        ext.rowid_hi = QueryString(stmt, 2);
+        ext.bytes    = (idx_t)QueryNumber(stmt, 3);
+        extents.emplace_back(QueryString(stmt, 4), std::move(ext));
+    };
+
+    bool found = false;
+    try {
+        ForEachRow(build_sql("DBA_EXTENTS", "DBA_OBJECTS", " AND o.OWNER = e.OWNER "),
+                   "GetTableExtents", read_row);
+        found = true;
+    } catch (const std::exception &) {
+        // DBA ビューの権限がない場合は自スキーマに限り USER_EXTENTS を使う
+        extents.clear();
+    }
+    if (!found && owner == OracleUtils::ToUpper(params_.user)) {
+        try {
+            ForEachRow(build_sql("USER_EXTENTS", "USER_OBJECTS", ""),
+                       "GetTableExtents", read_row);
+        } catch (const std::exception &) {
+            extents.clear();
         }
+    }
+    // 途中で失敗した場合に半端な結果を渡さないよう、読み終えてから渡す
+    for (auto &entry : extents) {
+        row(entry.first, std::move(entry.second));
+    }
+}
+
+// ─── GetTableSizeEstimate ─────────────────────────────────────────────────────
+
+idx_t OracleConnection::GetTableSizeEstimate(const std::string &schema,
+                                             const std::string &table) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    std::string sql =
+        "SELECT NVL(NUM_ROWS, 0) * NVL(AVG_ROW_LEN, 0) "
+        "FROM ALL_TABLES "
+        "WHERE OWNER = '" + OracleUtils::ToUpper(schema) + "' "
+        "  AND TABLE_NAME = '" + OracleUtils::ToUpper(table) + "'";
+    idx_t bytes = 0;
+    ForEachRow(sql, "GetTableSizeEstimate", [&](dpiStmt *stmt) {
+        bytes = (idx_t)QueryNumber(stmt, 1);
+    });
+    return bytes;
+}
+
+// ─── GetPartitionScheme ───────────────────────────────────────────────────────
+
+OraclePartitionScheme
+OracleConnection::GetPartitionScheme(const std::string &schema, const std::string &table) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    OraclePartitionScheme scheme;
+
+    std::string owner = OracleUtils::ToUpper(schema);
+    std::string name  = OracleUtils::ToUpper(table);
+
+    ForEachRow("SELECT PARTITIONING_TYPE FROM ALL_PART_TABLES "
+               "WHERE OWNER = '" + owner + "' AND TABLE_NAME = '" + name + "'",
+               "GetPartitionScheme", [&](dpiStmt *stmt) {
+        scheme.type = QueryString(stmt, 1);
+    });
+    if (scheme.type.empty()) {
+        return scheme;
+    }
+
+    ForEachRow("SELECT COLUMN_NAME FROM ALL_PART_KEY_COLUMNS "
+               "WHERE OWNER = '" + owner + "' AND NAME = '" + name + "' "
+               "  AND OBJECT_TYPE = 'TABLE' "
+               "ORDER BY COLUMN_POSITION",
+               "GetPartitionScheme", [&](dpiStmt *stmt) {
+        scheme.key_columns.push_back(QueryString(stmt, 1));
+    });
+    return scheme;
+}
 
-        for (uint32_t col = 0; col < num_cols && col < types.size(); ++col) {
-            dpiData *data;
-            dpiNativeTypeNum actual_native;
-            dpiStmt_getQueryValue(stmt, col + 1, &actual_native, &data);
+// ─── GetPartitions ────────────────────────────────────────────────────────────
 
-            Value val = OracleTypeMapping::ToDuckDBValue(data, actual_native, types[col]);
-            chunk.SetValue(col, row_count, val);
+std::vector<OraclePartitionInfo>
+OracleConnection::GetPartitions(const std::string &schema, const std::string &table) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    std::vector<OraclePartitionInfo> partitions;
+
+    std::string where =
+        "WHERE TABLE_OWNER = '" + OracleUtils::ToUpper(schema) + "' "
+        "  AND TABLE_NAME = '" + OracleUtils::ToUpper(table) + "' ";
+    // 統計がなければブロック数 × 8KB で見積る
+    const std::string size_expr =
+        "NVL(NUM_ROWS * AVG_ROW_LEN, NVL(BLOCKS, 0) * 8192)";
+
+    // HIGH_VALUE は LONG なので結合や WHERE に使えない。最上位パーティションを
+    // 単独で読み、サブパーティションには親の境界を引き写す
+    ForEachRow("SELECT PARTITION_NAME, " + size_expr + ", PARTITION_POSITION, HIGH_VALUE "
+               "FROM ALL_TAB_PARTITIONS " + where +
+               "ORDER BY PARTITION_POSITION",
+               "GetPartitions", [&](dpiStmt *stmt) {
+        OraclePartitionInfo part;
+        part.name       = QueryString(stmt, 1);
+        part.bytes      = (idx_t)QueryNumber(stmt, 2);
+        part.position   = (idx_t)QueryNumber(stmt, 3);
+        part.high_value = QueryString(stmt, 4);
+        partitions.push_back(std::move(part));
+    });
+
+    // サブパーティションがあればそれが実際のセグメント
+    std::vector<OraclePartitionInfo> subpartitions;
+    ForEachRow("SELECT PARTITION_NAME, SUBPARTITION_NAME, " + size_expr + " "
+               "FROM ALL_TAB_SUBPARTITIONS " + where +
+               "ORDER BY PARTITION_NAME, SUBPARTITION_POSITION",
+               "GetPartitions", [&](dpiStmt *stmt) {
+        OraclePartitionInfo part;
+        part.parent = QueryString(stmt, 1);
+        part.name   = QueryString(stmt, 2);
+        part.is_subpartition = true;
+        part.bytes  = (idx_t)QueryNumber(stmt, 3);
+        subpartitions.push_back(std::move(part));
+    });
+    if (subpartitions.empty()) {
+        return partitions;
+    }
+
+    std::unordered_map<std::string, const OraclePartitionInfo *> by_name;
+    for (const auto &part : partitions) {
+        by_name[part.name] = &part;
+    }
+    for (auto &sub : subpartitions) {
+        auto it = by_name.find(sub.parent);
+        if (it != by_name.end()) {
+            sub.position   = it->second->position;
+            sub.high_value = it->second->high_value;
         }
-        ++row_count;
+    }
+    return subpartitions;
+}
 
-        if (row_count == CHUNK_SIZE) {
-            chunk.SetCardinality(row_count);
-            if (!callback(chunk)) {
-                break;
+// ─── GetKeyRangeBoundaries ────────────────────────────────────────────────────
+
+std::vector<std::string>
+OracleConnection::GetKeyRangeBoundaries(const std::string &schema, const std::string &table,
+                                        const std::string &column, bool is_date,
+                                        idx_t num_ranges) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    std::vector<std::string> bounds;
+    if (num_ranges < 2) return bounds;
+
+    std::string owner = OracleUtils::ToUpper(schema);
+    std::string name  = OracleUtils::ToUpper(table);
+    std::string col   = OracleUtils::ToUpper(column);
+
+    // 日付は文字列で受け取り TO_DATE(...) リテラルにする
+    const std::string date_fmt = "'SYYYY-MM-DD HH24:MI:SS'";
+    auto to_literal = [&](const std::string &text) {
+        return is_date ? "TO_DATE('" + text + "', " + date_fmt + ")" : text;
+    };
+
+    // ヒストグラムのエンドポイント（ENDPOINT_NUMBER は累積の行数 / バケット番号）。
+    // 日付の ENDPOINT_VALUE はユリウス日（小数部が時刻）
+    const std::string value_expr = is_date
+        ? "TO_CHAR(TO_DATE(TRUNC(ENDPOINT_VALUE), 'J') + "
+          "(ENDPOINT_VALUE - TRUNC(ENDPOINT_VALUE)), " + date_fmt + ")"
+        : "TO_CHAR(ENDPOINT_VALUE, 'TM9')";
+    std::vector<std::pair<double, std::string>> endpoints;
+    ForEachRow("SELECT ENDPOINT_NUMBER, " + value_expr + " "
+               "FROM ALL_TAB_HISTOGRAMS "
+               "WHERE OWNER = '" + owner + "' AND TABLE_NAME = '" + name + "' "
+               "  AND COLUMN_NAME = '" + col + "' "
+               "ORDER BY ENDPOINT_NUMBER",
+               "GetKeyRangeBoundaries", [&](dpiStmt *stmt) {
+        endpoints.emplace_back(QueryNumber(stmt, 1), QueryString(stmt, 2));
+    });
+
+    // 最小値・最大値の 2 点だけならヒストグラムなし
+    if (endpoints.size() > 2) {
+        const double total = endpoints.back().first;
+        idx_t ep = 0;
+        for (idx_t i = 1; i < num_ranges; ++i) {
+            const double target = total * (double)i / (double)num_ranges;
+            while (ep < endpoints.size() - 1 && endpoints[ep].first < target) ++ep;
+            std::string lit = to_literal(endpoints[ep].second);
+            // 頻度の高い値が複数の区切りにまたがる場合は 1 つにまとめる
+            if (bounds.empty() || bounds.back() != lit) {
+                bounds.push_back(std::move(lit));
             }
-            chunk.Reset();
-            row_count = 0;
         }
+        return bounds;
     }
 
-    // 残りを flush
-    if (row_count > 0) {
-        chunk.SetCardinality(row_count);
-        callback(chunk);
+    // ヒストグラムがなければ 1% サンプルを NTILE で等分し、各グループの最大値を境界にする
+    std::string key = OracleUtils::QuoteIdentifier(col);
+    std::string sql =
+        "SELECT " + (is_date ? "TO_CHAR(MAX(k__), " + date_fmt + ")"
+                             : std::string("TO_CHAR(MAX(k__), 'TM9')")) + " FROM ("
+        "  SELECT " + key + " k__, NTILE(" + std::to_string(num_ranges) + ") "
+        "         OVER (ORDER BY " + key + ") grp__ "
+        "  FROM " + OracleUtils::QuoteIdentifier(owner) + "." +
+        OracleUtils::QuoteIdentifier(name) + " SAMPLE (1) "
+        "  WHERE " + key + " IS NOT NULL) "
+        "GROUP BY grp__ ORDER BY MAX(k__)";
+    ForEachRow(sql, "GetKeyRangeBoundaries", [&](dpiStmt *stmt) {
+        std::string lit = to_literal(QueryString(stmt, 1));
+        if (bounds.empty() || bounds.back() != lit) {
+            bounds.push_back(std::move(lit));
+        }
+    });
+    // 最後のグループの最大値は上限なし（末尾）として扱う
+    if (!bounds.empty()) {
+        bounds.pop_back();
     }
+    return bounds;
+}
 
-    dpiStmt_release(stmt);
+// ─── GetSampledRowidBoundaries ────────────────────────────────────────────────
+
+std::vector<std::string>
+OracleConnection::GetSampledRowidBoundaries(const std::string &schema,
+                                            const std::string &table,
+                                            idx_t num_ranges) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    std::vector<std::string> bounds;
+
+    // 1% のブロックをサンプリングし、ROWID 順に num_ranges 等分した各グループの
+    // 最小 ROWID を境界とする
+    std::string sql =
+        "SELECT ROWIDTOCHAR(MIN(rid__)) FROM ("
+        "  SELECT ROWID rid__, NTILE(" + std::to_string(num_ranges) + ") "
+        "         OVER (ORDER BY ROWID) grp__ "
+        "  FROM " + OracleUtils::QuoteIdentifier(OracleUtils::ToUpper(schema)) + "." +
+        OracleUtils::QuoteIdentifier(OracleUtils::ToUpper(table)) + " SAMPLE BLOCK (1)) "
+        "GROUP BY grp__ ORDER BY 1";
+    ForEachRow(sql, "GetSampledRowidBoundaries", [&](dpiStmt *stmt) {
+        bounds.push_back(QueryString(stmt, 1));
+    });
+    // 先頭グループの最小値は下限なし（テーブル先頭）として扱う
+    if (!bounds.empty()) {
+        bounds.erase(bounds.begin());
+    }
+    return bounds;
+}
+
+// ─── ExecuteQuery ─────────────────────────────────────────────────────────────
+
+void OracleConnection::ExecuteQuery(const std::string &sql,
+                                     const std::vector<LogicalType> &types,
+                                     idx_t fetch_size,
+                                     std::function<bool(DataChunk &)> callback) {
+    std::lock_guard<std::mutex> lk(mutex_);
+
+    auto sizing = OracleFetchSizing::FromParams(params_);
+    if (fetch_size > 0) {
+        sizing.fixed_rows = fetch_size;
+    }
+    OracleQueryCursor cursor(*this, sql, types, sizing);
+
+    DataChunk chunk;
+    chunk.Initialize(Allocator::DefaultAllocator(), types);
+
+    while (cursor.Fetch(chunk)) {
+        if (!callback(chunk)) {
+            break; // cursor のデストラクタでステートメントを閉じる
+        }
+        chunk.Reset();
+    }
 }
 
 // ─── ExecuteDML ───────────────────────────────────────────────────────────────
@@ -367,8 +881,12 @@ void OracleConnection::BulkInsert(const std::string &table_name,
                     dpiStmt_bindValueByPos(stmt, (uint32_t)(col + 1),
                                           DPI_NATIVE_TYPE_DOUBLE, &data);
                     break;
-                case LogicalTypeId::VARCHAR: {
-                    auto s = val.GetValue<std::string>();
+                case LogicalTypeId::VARCHAR:
+                case LogicalTypeId::ARRAY:
+                case LogicalTypeId::LIST: {
+                    // ARRAY / LIST は '[1.0, 2.0]' 形式の文字列で渡し、VECTOR 列へは
+                    // Oracle 側で暗黙に変換させる
+                    auto s = val.ToString();
                     data.value.asBytes.ptr = const_cast<char *>(s.c_str());
                     data.value.asBytes.length = (uint32_t)s.size();
                     dpiStmt_bindValueByPos(stmt, (uint32_t)(col + 1),
@@ -0,0 +1,238 @@
+#include "oracle_io_executor.hpp"
+
+namespace duckdb {
+
+// ─── OracleIOStream ──────────────────────────────────────────────────────────
+
+OracleIOStream::OracleIOStream(const std::vector<LogicalType> &types, idx_t capacity,
+                               OracleMemoryBudget *budget, idx_t chunk_bytes,
+                               produce_t produce, std::function<void()> interrupt)
+    : produce_(std::move(produce)), interrupt_(std::move(interrupt)),
+      free_(MaxValue<idx_t>(capacity, 1) + 1), ready_(MaxValue<idx_t>(capacity, 1) + 1) {
+    // capacity 個を先読みしつつ、消費側が 1 つ参照していられるように +1。
+    // 予算が足りなければ 1 個先読み + 参照中 1 個まで減らす
+    idx_t num_slots = MaxValue<idx_t>(capacity, 1) + 1;
+    chunk_bytes = MaxValue<idx_t>(chunk_bytes, 1);
+    idx_t granted = reservation_.Reserve(budget, 2 * chunk_bytes, num_slots * chunk_bytes);
+    num_slots = MinValue<idx_t>(num_slots, MaxValue<idx_t>(granted / chunk_bytes, 2));
+    for (idx_t i = 0; i < num_slots; ++i) {
+        auto chunk = make_uniq<DataChunk>();
+        chunk->Initialize(Allocator::DefaultAllocator(), types);
+        free_.Push(chunk.get());
+        slots_.push_back(std::move(chunk));
+    }
+}
+
+// ─── TryNext ──────────────────────────────────────────────────────────────────
+
+OracleIOStatus OracleIOStream::TryNext(DataChunk &output) {
+    // 前回渡したチャンクは消費済みなので I/O 側に戻す
+    if (current_) {
+        free_.Push(current_);
+        current_ = nullptr;
+        ScheduleIfRunnable();
+    }
+
+    DataChunk *chunk = nullptr;
+    if (ready_.Pop(chunk)) {
+        current_ = chunk;
+        output.Reference(*chunk);
+        return OracleIOStatus::READY;
+    }
+    if (!finished_.load(std::memory_order_acquire)) {
+        return OracleIOStatus::PENDING;
+    }
+    // finished_ の直前に積まれた分を取りこぼさない
+    if (ready_.Pop(chunk)) {
+        current_ = chunk;
+        output.Reference(*chunk);
+        return OracleIOStatus::READY;
+    }
+    if (error_) {
+        std::rethrow_exception(error_);
+    }
+    return OracleIOStatus::FINISHED;
+}
+
+// ─── Wait ─────────────────────────────────────────────────────────────────────
+
+void OracleIOStream::Wait() {
+    std::unique_lock<std::mutex> lk(wait_mutex_);
+    wait_cv_.wait(lk, [&]() {
+        return !ready_.Empty() || finished_.load(std::memory_order_acquire) ||
+               cancelled_.load();
+    });
+}
+
+// ─── Next ─────────────────────────────────────────────────────────────────────
+
+bool OracleIOStream::Next(DataChunk &output) {
+    while (true) {
+        switch (TryNext(output)) {
+        case OracleIOStatus::READY:
+            return true;
+        case OracleIOStatus::FINISHED:
+            return false;
+        case OracleIOStatus::PENDING:
+            Wait();
+            break;
+        }
+    }
+}
+
+// ─── Cancel ───────────────────────────────────────────────────────────────────
+
+void OracleIOStream::Cancel() {
+    {
+        // Wait 中の待機タスクも起こす
+        std::lock_guard<std::mutex> lk(wait_mutex_);
+        cancelled_.store(true);
+    }
+    wait_cv_.notify_all();
+    std::unique_lock<std::mutex> lk(wait_mutex_);
+    // LIMIT 等で途中終了した場合、フェッチ中のラウンドトリップを打ち切る
+    if (running_ && interrupt_) {
+        interrupt_();
+    }
+    wait_cv_.wait(lk, [&]() { return !running_; });
+}
+
+// ─── ScheduleIfRunnable ───────────────────────────────────────────────────────
+
+void OracleIOStream::ScheduleIfRunnable() {
+    if (finished_.load() || cancelled_.load() || free_.Empty()) {
+        return;
+    }
+    // 消費側と I/O スレッドの両方から呼ばれるので、実行待ちに入れるのは 1 回だけ
+    bool expected = false;
+    if (scheduled_.compare_exchange_strong(expected, true)) {
+        executor_->Enqueue(shared_from_this());
+    }
+}
+
+// ─── RunOnce ──────────────────────────────────────────────────────────────────
+
+void OracleIOStream::RunOnce() {
+    {
+        std::lock_guard<std::mutex> lk(wait_mutex_);
+        if (cancelled_.load()) {
+            return; // 消費側はもういない。scheduled_ は立てたままにして二度と入れない
+        }
+        running_ = true;
+    }
+
+    bool finished = false;
+    DataChunk *slot = nullptr;
+    if (free_.Pop(slot)) {
+        try {
+            slot->Reset();
+            if (produce_(*slot)) {
+                ready_.Push(slot);
+            } else {
+                finished = true;
+            }
+        } catch (...) {
+            error_   = std::current_exception();
+            finished = true;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lk(wait_mutex_);
+        running_ = false;
+        if (finished) {
+            finished_.store(true, std::memory_order_release);
+        }
+    }
+    wait_cv_.notify_all();
+
+    if (!finished) {
+        // 空きスロットが残っていれば続ける。ちょうど消費側が返した場合に
+        // 取りこぼさないよう、フラグを下ろしてから改めて確認する
+        scheduled_.store(false);
+        ScheduleIfRunnable();
+    }
+}
+
+// ─── OracleIOExecutor ────────────────────────────────────────────────────────
+
+OracleIOExecutor::OracleIOExecutor(idx_t num_threads)
+    : num_threads_(MaxValue<idx_t>(num_threads, 1)) {}
+
+OracleIOExecutor::~OracleIOExecutor() {
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        shutdown_ = true;
+    }
+    cv_.notify_all();
+    for (auto &thread : threads_) {
+        thread.join();
+    }
+}
+
+// ─── Start ────────────────────────────────────────────────────────────────────
+
+std::shared_ptr<OracleIOStream>
+OracleIOExecutor::Start(const void *group, const std::vector<LogicalType> &types,
+                        idx_t capacity, OracleMemoryBudget *budget, idx_t chunk_bytes,
+                        OracleIOStream::produce_t produce, std::function<void()> interrupt) {
+    {
+        // スレッドは最初のスキャンで起こす（ATTACH しただけでは作らない）
+        std::lock_guard<std::mutex> lk(mutex_);
+        while (threads_.size() < num_threads_) {
+            threads_.emplace_back([this]() { WorkerLoop(); });
+        }
+    }
+
+    auto stream = std::make_shared<OracleIOStream>(types, capacity, budget, chunk_bytes,
+                                                   std::move(produce), std::move(interrupt));
+    stream->executor_ = this;
+    stream->group_    = group;
+    stream->ScheduleIfRunnable();
+    return stream;
+}
+
+// ─── Enqueue ──────────────────────────────────────────────────────────────────
+
+void OracleIOExecutor::Enqueue(std::shared_ptr<OracleIOStream> stream) {
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        auto &group = groups_[stream->group_];
+        if (!group) {
+            group = std::make_shared<Group>();
+        }
+        if (group->runnable.empty()) {
+            active_.push_back(group);
+        }
+        group->runnable.push_back(std::move(stream));
+    }
+    cv_.notify_one();
+}
+
+// ─── WorkerLoop ───────────────────────────────────────────────────────────────
+
+void OracleIOExecutor::WorkerLoop() {
+    while (true) {
+        std::shared_ptr<OracleIOStream> stream;
+        {
+            std::unique_lock<std::mutex> lk(mutex_);
+            cv_.wait(lk, [&]() { return shutdown_ || !active_.empty(); });
+            if (shutdown_) {
+                return;
+            }
+            // 先頭グループから 1 ストリームだけ取り、グループは末尾に回す
+            auto group = active_.front();
+            active_.pop_front();
+            stream = std::move(group->runnable.front());
+            group->runnable.pop_front();
+            if (!group->runnable.empty()) {
+                active_.push_back(group);
+            } else {
+                groups_.erase(stream->group_);
+            }
+        }
+        stream->RunOnce();
+    }
+}
+
+} // namespace duckdb
@@ -0,0 +1,260 @@
+#include "oracle_json.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/interval.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include <cstdio>
+#include <cstring>
+
+namespace duckdb {
+
+// ─── 共通ヘルパー ─────────────────────────────────────────────────────────────
+
+// JSON 文字列として引用符付きで追加する。エスケープ不要な区間はまとめてコピーする
+static void AppendQuoted(const char *ptr, uint32_t len, std::string &out) {
+    static const char HEX[] = "0123456789abcdef";
+    out += '"';
+    uint32_t run = 0;
+    for (uint32_t i = 0; i < len; ++i) {
+        unsigned char c = (unsigned char)ptr[i];
+        if (c >= 0x20 && c != '"' && c != '\\') continue;
+        out.append(ptr + run, i - run);
+        run = i + 1;
+        switch (c) {
+        case '"':  out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n";  break;
+        case '\r': out += "\\r";  break;
+        case '\t': out += "\\t";  break;
+        case '\b': out += "\\b";  break;
+        case '\f': out += "\\f";  break;
+        default:
+            out += "\\u00";
+            out += HEX[c >> 4];
+            out += HEX[c & 0xF];
+            break;
+        }
+    }
+    out.append(ptr + run, len - run);
+    out += '"';
+}
+
+// RAW / JSON_ID は Oracle の直列化と同じく 16 進文字列にする
+static void AppendHex(const char *ptr, uint32_t len, std::string &out) {
+    static const char HEX[] = "0123456789ABCDEF";
+    out += '"';
+    for (uint32_t i = 0; i < len; ++i) {
+        unsigned char c = (unsigned char)ptr[i];
+        out += HEX[c >> 4];
+        out += HEX[c & 0xF];
+    }
+    out += '"';
+}
+
+// ISO 8601（"2024-01-31T12:34:56.123456"）
+static void AppendTimestamp(const dpiTimestamp &ts, std::string &out) {
+    char buf[40];
+    int n = snprintf(buf, sizeof(buf), "\"%04d-%02u-%02uT%02u:%02u:%02u",
+                     (int)ts.year, (unsigned)ts.month, (unsigned)ts.day,
+                     (unsigned)ts.hour, (unsigned)ts.minute, (unsigned)ts.second);
+    if (ts.fsecond != 0) {
+        n += snprintf(buf + n, sizeof(buf) - n, ".%06u", (unsigned)(ts.fsecond / 1000));
+    }
+    out.append(buf, n);
+    out += '"';
+}
+
+static const dpiJsonNode *FindField(const dpiJsonObject &obj, const std::string &name) {
+    for (uint32_t i = 0; i < obj.numFields; ++i) {
+        if (obj.fieldNameLengths[i] == name.size() &&
+            memcmp(obj.fieldNames[i], name.data(), name.size()) == 0) {
+            return &obj.fields[i];
+        }
+    }
+    // DuckDB の列名は大文字小文字を区別しないので、完全一致がなければ緩めて探す
+    for (uint32_t i = 0; i < obj.numFields; ++i) {
+        if (StringUtil::CIEquals(std::string(obj.fieldNames[i], obj.fieldNameLengths[i]),
+                                 name)) {
+            return &obj.fields[i];
+        }
+    }
+    return nullptr;
+}
+
+// ─── AppendText ───────────────────────────────────────────────────────────────
+
+void OracleJson::AppendText(const dpiJsonNode *node, std::string &out) {
+    const dpiDataBuffer *value = node->value;
+    switch (node->nativeTypeNum) {
+    case DPI_NATIVE_TYPE_NULL:
+        out += "null";
+        return;
+
+    case DPI_NATIVE_TYPE_JSON_OBJECT: {
+        const auto &obj = value->asJsonObject;
+        out += '{';
+        for (uint32_t i = 0; i < obj.numFields; ++i) {
+            if (i > 0) out += ',';
+            AppendQuoted(obj.fieldNames[i], obj.fieldNameLengths[i], out);
+            out += ':';
+            AppendText(&obj.fields[i], out);
+        }
+        out += '}';
+        return;
+    }
+
+    case DPI_NATIVE_TYPE_JSON_ARRAY: {
+        const auto &arr = value->asJsonArray;
+        out += '[';
+        for (uint32_t i = 0; i < arr.numElements; ++i) {
+            if (i > 0) out += ',';
+            AppendText(&arr.elements[i], out);
+        }
+        out += ']';
+        return;
+    }
+
+    case DPI_NATIVE_TYPE_BYTES:
+        if (node->oracleTypeNum == DPI_ORACLE_TYPE_NUMBER) {
+            // NUMBER_AS_STRING の 10 進テキストはそのまま JSON の数値になる
+            out.append(value->asBytes.ptr, value->asBytes.length);
+        } else if (node->oracleTypeNum == DPI_ORACLE_TYPE_RAW ||
+                   node->oracleTypeNum == DPI_ORACLE_TYPE_JSON_ID) {
+            AppendHex(value->asBytes.ptr, value->asBytes.length, out);
+        } else {
+            AppendQuoted(value->asBytes.ptr, value->asBytes.length, out);
+        }
+        return;
+
+    case DPI_NATIVE_TYPE_BOOLEAN:
+        out += value->asBoolean ? "true" : "false";
+        return;
+
+    case DPI_NATIVE_TYPE_TIMESTAMP:
+        AppendTimestamp(value->asTimestamp, out);
+        return;
+
+    default: {
+        // BINARY_DOUBLE / BINARY_FLOAT / INTERVAL など
+        auto v = ScalarValue(node);
+        bool numeric = v.type().IsNumeric();
+        if (!numeric) out += '"';
+        out += v.ToString();
+        if (!numeric) out += '"';
+        return;
+    }
+    }
+}
+
+// ─── ScalarValue ──────────────────────────────────────────────────────────────
+
+Value OracleJson::ScalarValue(const dpiJsonNode *node) {
+    const dpiDataBuffer *value = node->value;
+    switch (node->nativeTypeNum) {
+    case DPI_NATIVE_TYPE_NULL:
+        return Value();
+    case DPI_NATIVE_TYPE_BYTES:
+        if (node->oracleTypeNum == DPI_ORACLE_TYPE_RAW ||
+            node->oracleTypeNum == DPI_ORACLE_TYPE_JSON_ID) {
+            return Value::BLOB(const_data_ptr_cast(value->asBytes.ptr), value->asBytes.length);
+        }
+        return Value(std::string(value->asBytes.ptr, value->asBytes.length));
+    case DPI_NATIVE_TYPE_DOUBLE:
+        return Value::DOUBLE(value->asDouble);
+    case DPI_NATIVE_TYPE_FLOAT:
+        return Value::FLOAT(value->asFloat);
+    case DPI_NATIVE_TYPE_BOOLEAN:
+        return Value::BOOLEAN(value->asBoolean != 0);
+    case DPI_NATIVE_TYPE_TIMESTAMP: {
+        const auto &ts = value->asTimestamp;
+        return Value::TIMESTAMP(ts.year, ts.month, ts.day, ts.hour, ts.minute, ts.second,
+                                (int32_t)(ts.fsecond / 1000));
+    }
+    case DPI_NATIVE_TYPE_INTERVAL_DS: {
+        const auto &iv = value->asIntervalDS;
+        int64_t micros = ((int64_t)iv.hours * 3600 + (int64_t)iv.minutes * 60 + iv.seconds) *
+                             Interval::MICROS_PER_SEC +
+                         iv.fseconds / 1000;
+        return Value::INTERVAL(0, iv.days, micros);
+    }
+    case DPI_NATIVE_TYPE_INTERVAL_YM: {
+        const auto &iv = value->asIntervalYM;
+        return Value::INTERVAL(iv.years * 12 + iv.months, 0, 0);
+    }
+    default: {
+        // オブジェクト / 配列をスカラー型に入れようとした。キャスト側でエラーにさせる
+        std::string text;
+        AppendText(node, text);
+        return Value(text);
+    }
+    }
+}
+
+// ─── Write ────────────────────────────────────────────────────────────────────
+
+void OracleJson::Write(const dpiJsonNode *node, Vector &result, idx_t row) {
+    if (node->nativeTypeNum == DPI_NATIVE_TYPE_NULL) {
+        FlatVector::SetNull(result, row, true);
+        return;
+    }
+
+    const auto &type = result.GetType();
+    switch (type.id()) {
+    case LogicalTypeId::STRUCT: {
+        if (node->nativeTypeNum != DPI_NATIVE_TYPE_JSON_OBJECT) {
+            throw ConversionException("Oracle JSON value is not an object (expected %s)",
+                                      type.ToString());
+        }
+        const auto &obj         = node->value->asJsonObject;
+        auto       &children    = StructVector::GetEntries(result);
+        const auto &child_types = StructType::GetChildTypes(type);
+        for (idx_t k = 0; k < children.size(); ++k) {
+            const dpiJsonNode *field = FindField(obj, child_types[k].first);
+            if (field) {
+                Write(field, *children[k], row);
+            } else {
+                FlatVector::SetNull(*children[k], row, true);
+            }
+        }
+        return;
+    }
+
+    case LogicalTypeId::LIST: {
+        if (node->nativeTypeNum != DPI_NATIVE_TYPE_JSON_ARRAY) {
+            throw ConversionException("Oracle JSON value is not an array (expected %s)",
+                                      type.ToString());
+        }
+        const auto &arr  = node->value->asJsonArray;
+        idx_t       size = ListVector::GetListSize(result);
+        ListVector::Reserve(result, size + arr.numElements);
+        auto &child = ListVector::GetEntry(result);
+        for (uint32_t i = 0; i < arr.numElements; ++i) {
+            Write(&arr.elements[i], child, size + i);
+        }
+        ListVector::SetListSize(result, size + arr.numElements);
+        FlatVector::GetData<list_entry_t>(result)[row] = list_entry_t(size, arr.numElements);
+        return;
+    }
+
+    case LogicalTypeId::VARCHAR: {
+        auto out = FlatVector::GetData<string_t>(result);
+        if (!type.IsJSONType() && node->nativeTypeNum == DPI_NATIVE_TYPE_BYTES &&
+            node->oracleTypeNum == DPI_ORACLE_TYPE_VARCHAR) {
+            // VARCHAR のフィールドに入る JSON 文字列は引用符なしの値
+            out[row] = StringVector::AddString(result, node->value->asBytes.ptr,
+                                               node->value->asBytes.length);
+            return;
+        }
+        std::string text;
+        AppendText(node, text);
+        out[row] = StringVector::AddString(result, text);
+        return;
+    }
+
+    default:
+        result.SetValue(row, ScalarValue(node).DefaultCastAs(type));
+        return;
+    }
+}
+
+} // namespace duckdb
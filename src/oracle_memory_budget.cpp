@@ -0,0 +1,98 @@
+#include "oracle_memory_budget.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+// ─── OracleMemoryBudget ──────────────────────────────────────────────────────
+
+constexpr std::chrono::milliseconds OracleMemoryBudget::MAX_WAIT;
+
+OracleMemoryBudget::OracleMemoryBudget(BufferManager &buffer_manager, idx_t limit)
+    : buffer_manager_(buffer_manager), limit_(MaxValue<idx_t>(limit, 1)) {}
+
+idx_t OracleMemoryBudget::GetReserved() {
+    std::lock_guard<std::mutex> lk(mutex_);
+    return reserved_;
+}
+
+// ─── Reserve ──────────────────────────────────────────────────────────────────
+
+idx_t OracleMemoryBudget::Reserve(idx_t min_bytes, idx_t want_bytes) {
+    want_bytes = MaxValue<idx_t>(want_bytes, min_bytes);
+    if (want_bytes == 0) return 0;
+
+    idx_t grant;
+    {
+        std::unique_lock<std::mutex> lk(mutex_);
+        // 最小量の空きができるまで待つ（バックプレッシャー）。待っても空かなければ
+        // 超過を許す: 予約を持つ側が同じ I/O スレッドの順番待ちをしていることがある
+        cv_.wait_for(lk, MAX_WAIT, [&]() { return reserved_ + min_bytes <= limit_; });
+        idx_t available = reserved_ < limit_ ? limit_ - reserved_ : 0;
+        grant = MaxValue<idx_t>(MinValue<idx_t>(want_bytes, available), min_bytes);
+        reserved_ += grant;
+    }
+
+    // DuckDB 側で確保できなかった分は予算からも戻す
+    idx_t granted = 0;
+    try {
+        granted = ReserveFromBufferManager(min_bytes, grant);
+    } catch (...) {
+        ReturnToBudget(grant);
+        throw;
+    }
+    if (granted < grant) {
+        ReturnToBudget(grant - granted);
+    }
+    return granted;
+}
+
+idx_t OracleMemoryBudget::ReserveFromBufferManager(idx_t min_bytes, idx_t bytes) {
+    while (true) {
+        try {
+            // 必要なら DuckDB のバッファを追い出して場所を空ける
+            buffer_manager_.ReserveMemory(bytes);
+            return bytes;
+        } catch (OutOfMemoryException &) {
+            if (bytes <= min_bytes) throw;
+            bytes = MaxValue<idx_t>(bytes / 2, min_bytes);
+        }
+    }
+}
+
+// ─── Release ──────────────────────────────────────────────────────────────────
+
+void OracleMemoryBudget::Release(idx_t bytes) {
+    if (bytes == 0) return;
+    buffer_manager_.FreeReservedMemory(bytes);
+    ReturnToBudget(bytes);
+}
+
+void OracleMemoryBudget::ReturnToBudget(idx_t bytes) {
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        reserved_ -= MinValue<idx_t>(bytes, reserved_);
+    }
+    cv_.notify_all();
+}
+
+// ─── OracleMemoryReservation ─────────────────────────────────────────────────
+
+idx_t OracleMemoryReservation::Reserve(OracleMemoryBudget *budget, idx_t min_bytes,
+                                       idx_t want_bytes) {
+    Release();
+    if (!budget) return want_bytes;
+    size_   = budget->Reserve(min_bytes, want_bytes);
+    budget_ = budget;
+    return size_;
+}
+
+void OracleMemoryReservation::Release() {
+    if (budget_) {
+        budget_->Release(size_);
+    }
+    budget_ = nullptr;
+    size_   = 0;
+}
+
+} // namespace duckdb
@@ -6,6 +6,12 @@
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/planner/expression/bound_column_ref_expression.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/common/string_util.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
 #include <sstream>
 
 namespace duckdb {
@@ -73,7 +79,7 @@ std::string OracleFilterPushdown::ConstantToSQL(const BoundConstantExpression &e
 std::string OracleFilterPushdown::ColumnToSQL(const BoundColumnRefExpression &expr,
                                                const std::vector<std::string> &col_names) {
     idx_t col_idx = expr.binding.column_index;
-    if (col_idx >= col_names.size()) return "";
+    if (col_idx >= col_names.size() || col_names[col_idx].empty()) return "";
     return OracleUtils::QuoteIdentifier(col_names[col_idx]);
 }
 
@@ -193,6 +199,7 @@ void OracleFilterPushdown::PushdownFilters(OracleScanBindData &bind_data,
         std::string sql = ExpressionToSQL(*filter, column_names);
         if (!sql.empty()) {
             bind_data.filters.push_back(sql);
+            CollectPredicates(*filter, column_names, bind_data.predicates);
         } else {
             remaining.push_back(std::move(filter));
         }
@@ -200,4 +207,440 @@ void OracleFilterPushdown::PushdownFilters(OracleScanBindData &bind_data,
     filters = std::move(remaining);
 }
 
+// ─── CollectPredicates ────────────────────────────────────────────────────────
+
+void OracleFilterPushdown::CollectPredicates(const Expression &expr,
+                                             const std::vector<std::string> &col_names,
+                                             std::vector<OracleColumnPredicate> &predicates) {
+    if (expr.expression_class == ExpressionClass::BOUND_CONJUNCTION &&
+        expr.type == ExpressionType::CONJUNCTION_AND) {
+        for (const auto &child : expr.Cast<BoundConjunctionExpression>().children) {
+            CollectPredicates(*child, col_names, predicates);
+        }
+        return;
+    }
+    if (expr.expression_class != ExpressionClass::BOUND_COMPARISON) return;
+
+    const auto &cmp = expr.Cast<BoundComparisonExpression>();
+    const Expression *col = cmp.left.get();
+    const Expression *val = cmp.right.get();
+    ExpressionType comparison = cmp.type;
+    if (col->expression_class == ExpressionClass::BOUND_CONSTANT) {
+        // 定数 op カラム → カラム op' 定数
+        std::swap(col, val);
+        comparison = FlipComparisonExpression(comparison);
+    }
+    if (col->expression_class != ExpressionClass::BOUND_COLUMN_REF ||
+        val->expression_class != ExpressionClass::BOUND_CONSTANT) {
+        return;
+    }
+
+    idx_t col_idx = col->Cast<BoundColumnRefExpression>().binding.column_index;
+    const Value &constant = val->Cast<BoundConstantExpression>().value;
+    if (col_idx >= col_names.size() || col_names[col_idx].empty() || constant.IsNull()) {
+        return;
+    }
+    predicates.push_back({col_names[col_idx], comparison, constant});
+}
+
+// ─── PushdownSpatialFilters ───────────────────────────────────────────────────
+
+// WKB を読み進めながら座標の外接矩形を広げる。解釈できなければ false
+class WkbEnvelopeReader {
+public:
+    WkbEnvelopeReader(const char *data, idx_t size) : data_(data), size_(size) {}
+
+    bool Read(double bbox[4]) {
+        bbox_ = bbox;
+        bbox_[0] = bbox_[1] = INFINITY;
+        bbox_[2] = bbox_[3] = -INFINITY;
+        return ReadGeometry(0) && pos_ == size_;
+    }
+
+private:
+    bool ReadGeometry(int depth) {
+        if (depth > 32 || pos_ + 5 > size_) return false;
+        little_ = data_[pos_++] == 1;
+        uint32_t type;
+        if (!ReadUInt32(type)) return false;
+        // EWKB のフラグ（Z / M / SRID）と ISO の 1000 / 2000 / 3000
+        idx_t dims = 2;
+        if (type & 0x80000000u) dims++;
+        if (type & 0x40000000u) dims++;
+        if (type & 0x20000000u) {
+            uint32_t srid;
+            if (!ReadUInt32(srid)) return false;
+        }
+        type &= 0x0FFFFFFFu;
+        switch (type / 1000) {
+        case 1: case 2: dims = 3; break;
+        case 3:         dims = 4; break;
+        default: break;
+        }
+        uint32_t count;
+        switch (type % 1000) {
+        case 1: // Point
+            return ReadPoints(1, dims);
+        case 2: // LineString
+            return ReadUInt32(count) && ReadPoints(count, dims);
+        case 3: { // Polygon
+            uint32_t rings;
+            if (!ReadUInt32(rings)) return false;
+            for (uint32_t r = 0; r < rings; ++r) {
+                if (!ReadUInt32(count) || !ReadPoints(count, dims)) return false;
+            }
+            return true;
+        }
+        case 4: case 5: case 6: case 7: { // Multi* / GeometryCollection
+            if (!ReadUInt32(count)) return false;
+            for (uint32_t g = 0; g < count; ++g) {
+                if (!ReadGeometry(depth + 1)) return false;
+            }
+            return true;
+        }
+        default:
+            return false; // 曲線などは扱わない
+        }
+    }
+
+    bool ReadPoints(uint32_t count, idx_t dims) {
+        if ((size_ - pos_) / (dims * sizeof(double)) < count) return false;
+        for (uint32_t i = 0; i < count; ++i) {
+            double x = ReadDouble(), y = ReadDouble();
+            pos_ += (dims - 2) * sizeof(double);
+            if (std::isnan(x) || std::isnan(y)) continue; // 空の POINT
+            bbox_[0] = MinValue(bbox_[0], x);
+            bbox_[1] = MinValue(bbox_[1], y);
+            bbox_[2] = MaxValue(bbox_[2], x);
+            bbox_[3] = MaxValue(bbox_[3], y);
+        }
+        return true;
+    }
+
+    bool ReadUInt32(uint32_t &v) {
+        if (pos_ + 4 > size_) return false;
+        uint8_t b[4];
+        memcpy(b, data_ + pos_, 4);
+        pos_ += 4;
+        v = little_ ? (uint32_t)b[0] | (uint32_t)b[1] << 8 | (uint32_t)b[2] << 16 | (uint32_t)b[3] << 24
+                    : (uint32_t)b[3] | (uint32_t)b[2] << 8 | (uint32_t)b[1] << 16 | (uint32_t)b[0] << 24;
+        return true;
+    }
+
+    double ReadDouble() {
+        uint8_t b[8];
+        memcpy(b, data_ + pos_, 8);
+        pos_ += 8;
+        uint64_t bits = 0;
+        for (int i = 0; i < 8; ++i) {
+            bits |= (uint64_t)b[little_ ? i : 7 - i] << (8 * i);
+        }
+        double v;
+        memcpy(&v, &bits, sizeof(v));
+        return v;
+    }
+
+    const char *data_;
+    idx_t       size_;
+    idx_t       pos_ = 0;
+    bool        little_ = true;
+    double     *bbox_ = nullptr;
+};
+
+// 引数の組み合わせによらず「2 つのジオメトリが交わる」ことを含意する述語。
+// どれも外接矩形が重なる行しか真にならない
+static bool ImpliesIntersection(const std::string &fn) {
+    static const char *const NAMES[] = {
+        "st_intersects", "st_intersects_extent", "&&",       "st_contains",
+        "st_containsproperly", "st_within", "st_covers", "st_coveredby",
+        "st_equals",     "st_touches",    "st_overlaps", "st_crosses"};
+    for (auto name : NAMES) {
+        if (StringUtil::CIEquals(fn, name)) return true;
+    }
+    return false;
+}
+
+static std::string FormatOrdinate(double v) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.17g", v);
+    return buf;
+}
+
+// 外接矩形を SDO_GEOMETRY の問い合わせウィンドウにする。幅や高さが 0 の矩形は
+// 不正なので、点・線分にする
+static std::string EnvelopeToSdoGeometry(const double bbox[4], const std::string &srid) {
+    std::string x0 = FormatOrdinate(bbox[0]), y0 = FormatOrdinate(bbox[1]);
+    std::string x1 = FormatOrdinate(bbox[2]), y1 = FormatOrdinate(bbox[3]);
+    if (bbox[0] == bbox[2] && bbox[1] == bbox[3]) {
+        return "SDO_GEOMETRY(2001, " + srid + ", SDO_POINT_TYPE(" + x0 + ", " + y0 +
+               ", NULL), NULL, NULL)";
+    }
+    bool line = bbox[0] == bbox[2] || bbox[1] == bbox[3];
+    return "SDO_GEOMETRY(" + std::string(line ? "2002" : "2003") + ", " + srid +
+           ", NULL, SDO_ELEM_INFO_ARRAY(1, " + (line ? "2, 1" : "1003, 3") +
+           "), SDO_ORDINATE_ARRAY(" + x0 + ", " + y0 + ", " + x1 + ", " + y1 + "))";
+}
+
+void OracleFilterPushdown::PushdownSpatialFilters(ClientContext &context,
+                                                  OracleScanBindData &bind_data,
+                                                  const std::vector<std::string> &col_names,
+                                                  const std::vector<unique_ptr<Expression>> &filters) {
+    if (bind_data.spatial_srids.empty()) return;
+
+    LogicalType wkb_type = LogicalType::BLOB;
+    wkb_type.SetAlias("WKB_BLOB");
+
+    for (const auto &filter : filters) {
+        if (filter->expression_class != ExpressionClass::BOUND_FUNCTION) continue;
+        const auto &func = filter->Cast<BoundFunctionExpression>();
+        if (func.children.size() != 2 || !ImpliesIntersection(func.function.name)) continue;
+
+        // 片方が（GEOMETRY へキャストされた）列、もう片方が定数
+        const Expression *col = func.children[0].get();
+        const Expression *val = func.children[1].get();
+        if (col->expression_class == ExpressionClass::BOUND_CONSTANT) std::swap(col, val);
+        while (col->expression_class == ExpressionClass::BOUND_CAST) {
+            col = col->Cast<BoundCastExpression>().child.get();
+        }
+        if (col->expression_class != ExpressionClass::BOUND_COLUMN_REF ||
+            val->expression_class != ExpressionClass::BOUND_CONSTANT) {
+            continue;
+        }
+        idx_t col_idx = col->Cast<BoundColumnRefExpression>().binding.column_index;
+        if (col_idx >= col_names.size()) continue;
+        auto srid = bind_data.spatial_srids.find(col_names[col_idx]);
+        if (srid == bind_data.spatial_srids.end()) continue;
+
+        // 定数は spatial 拡張の GEOMETRY なので、拡張のキャストで WKB にする
+        const Value &constant = val->Cast<BoundConstantExpression>().value;
+        if (constant.IsNull()) continue;
+        Value wkb;
+        if (constant.type() == wkb_type) {
+            wkb = constant;
+        } else if (!constant.TryCastAs(context, wkb_type, wkb, nullptr)) {
+            continue;
+        }
+        const auto &bytes = StringValue::Get(wkb);
+        double bbox[4];
+        if (!WkbEnvelopeReader(bytes.data(), bytes.size()).Read(bbox) || bbox[0] > bbox[2]) {
+            continue; // 解釈できない / 空のジオメトリ
+        }
+        bind_data.filters.push_back(
+            "SDO_FILTER(" + OracleUtils::QuoteIdentifier(col_names[col_idx]) + ", " +
+            EnvelopeToSdoGeometry(bbox, srid->second) + ") = 'TRUE'");
+    }
+}
+
+// ─── PrunePartitions ──────────────────────────────────────────────────────────
+
+// HIGH_VALUE の 1 要素をリテラル文字列にする。解釈できなければ false。
+//   100 / -1.5                               → 数値
+//   'ABC'                                    → 文字列（'' はアンエスケープ）
+//   TO_DATE(' 2024-01-01 00:00:00', ...)     → 最初の引数
+//   TIMESTAMP' 2024-01-01 00:00:00' / DATE '2024-01-01'
+static bool ParseBoundLiteral(const std::string &item, std::string &literal) {
+    std::string upper = OracleUtils::ToUpper(item);
+    idx_t quote = item.find('\'');
+    if (quote == std::string::npos) {
+        // 数値のみ受け付ける
+        if (upper.empty() || upper.find_first_not_of("+-.0123456789E") != std::string::npos) {
+            return false;
+        }
+        literal = item;
+        return true;
+    }
+    if (quote != 0 && upper.rfind("TO_DATE(", 0) != 0 &&
+        upper.rfind("TIMESTAMP", 0) != 0 && upper.rfind("DATE", 0) != 0) {
+        return false;
+    }
+
+    literal.clear();
+    for (idx_t i = quote + 1; i < item.size(); ++i) {
+        if (item[i] == '\'') {
+            if (i + 1 < item.size() && item[i + 1] == '\'') {
+                literal += '\'';
+                ++i;
+                continue;
+            }
+            // 日付リテラルは先頭に空白（紀元前なら '-'）が付く
+            if (quote != 0) {
+                literal = OracleUtils::Trim(literal);
+                if (!literal.empty() && literal[0] == '-') return false;
+            }
+            return true;
+        }
+        literal += item[i];
+    }
+    return false; // 閉じクォートがない
+}
+
+// パーティションの境界値（RANGE なら上限 1 つ、LIST なら値の列挙）
+struct OraclePartitionBound {
+    bool               parsed = false;
+    bool               unbounded = false;  // MAXVALUE / DEFAULT
+    std::vector<Value> values;
+};
+
+static OraclePartitionBound ParsePartitionBound(const std::string &high_value,
+                                                const LogicalType &type) {
+    OraclePartitionBound bound;
+
+    // 括弧とクォートの外にあるカンマで要素に分ける
+    std::vector<std::string> items;
+    std::string cur;
+    int depth = 0;
+    bool in_quote = false;
+    for (char c : high_value) {
+        if (c == '\'') in_quote = !in_quote;
+        if (!in_quote) {
+            if (c == '(') depth++;
+            if (c == ')') depth--;
+            if (c == ',' && depth == 0) {
+                items.push_back(OracleUtils::Trim(cur));
+                cur.clear();
+                continue;
+            }
+        }
+        cur += c;
+    }
+    items.push_back(OracleUtils::Trim(cur));
+
+    for (const auto &item : items) {
+        std::string upper = OracleUtils::ToUpper(item);
+        if (upper == "MAXVALUE" || upper == "DEFAULT") {
+            bound.unbounded = true;
+            continue;
+        }
+        if (upper == "NULL") {
+            continue; // 比較述語は NULL に一致しない
+        }
+        std::string literal;
+        if (!ParseBoundLiteral(item, literal)) return bound;
+        Value value(literal);
+        if (!value.DefaultTryCastAs(type)) return bound;
+        bound.values.push_back(std::move(value));
+    }
+    bound.parsed = true;
+    return bound;
+}
+
+static bool CompareValues(const Value &lhs, ExpressionType comparison, const Value &rhs) {
+    switch (comparison) {
+    case ExpressionType::COMPARE_EQUAL:                return lhs == rhs;
+    case ExpressionType::COMPARE_NOTEQUAL:             return lhs != rhs;
+    case ExpressionType::COMPARE_LESSTHAN:             return lhs < rhs;
+    case ExpressionType::COMPARE_LESSTHANOREQUALTO:    return lhs <= rhs;
+    case ExpressionType::COMPARE_GREATERTHAN:          return lhs > rhs;
+    case ExpressionType::COMPARE_GREATERTHANOREQUALTO: return lhs >= rhs;
+    default:                                           return true;
+    }
+}
+
+// RANGE パーティション [lo, hi) に「key op c」を満たす値があり得るか
+static bool RangeMayMatch(const Value *lo, const Value *hi,
+                          ExpressionType comparison, const Value &c) {
+    switch (comparison) {
+    case ExpressionType::COMPARE_EQUAL:
+        return (!lo || *lo <= c) && (!hi || c < *hi);
+    case ExpressionType::COMPARE_LESSTHAN:
+        return !lo || *lo < c;
+    case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+        return !lo || *lo <= c;
+    case ExpressionType::COMPARE_GREATERTHAN:
+    case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+        return !hi || c < *hi;
+    default:
+        return true;
+    }
+}
+
+void OracleFilterPushdown::PrunePartitions(OracleScanBindData &bind_data) {
+    const auto &scheme = bind_data.partition_scheme;
+    if (bind_data.partitions.empty() || bind_data.predicates.empty() ||
+        scheme.key_columns.size() != 1) {
+        return;
+    }
+    const bool is_range = scheme.type == "RANGE";
+    const bool is_list  = scheme.type == "LIST";
+    if (!is_range && !is_list) return;
+
+    // キー列の DuckDB 型
+    const std::string &key = scheme.key_columns[0];
+    idx_t key_idx = DConstants::INVALID_INDEX;
+    for (idx_t i = 0; i < bind_data.all_columns.size(); ++i) {
+        if (bind_data.all_columns[i].name == key) {
+            key_idx = i;
+            break;
+        }
+    }
+    if (key_idx == DConstants::INVALID_INDEX || key_idx >= bind_data.all_types.size()) {
+        return;
+    }
+    const LogicalType &key_type = bind_data.all_types[key_idx];
+
+    // キー列に対する述語（型がキー列と一致するものだけ比較できる）
+    std::vector<const OracleColumnPredicate *> key_preds;
+    for (const auto &pred : bind_data.predicates) {
+        if (pred.column == key && pred.constant.type() == key_type) {
+            key_preds.push_back(&pred);
+        }
+    }
+    if (key_preds.empty()) return;
+
+    // 最上位パーティションの境界を位置順に解釈する（サブパーティションは親と共有）
+    std::map<idx_t, OraclePartitionBound> bounds;
+    for (const auto &part : bind_data.partitions) {
+        if (bounds.find(part.position) == bounds.end()) {
+            bounds[part.position] = ParsePartitionBound(part.high_value, key_type);
+        }
+    }
+
+    std::map<idx_t, bool> keep;
+    const OraclePartitionBound *prev = nullptr;
+    for (const auto &entry : bounds) {
+        const auto &bound = entry.second;
+        bool may_match = true;
+        if (!bound.parsed) {
+            may_match = true;
+        } else if (is_range) {
+            // 下限は直前パーティションの上限（取得できなければ下限なし扱い）
+            const Value *lo = (prev && prev->parsed && !prev->unbounded &&
+                               prev->values.size() == 1) ? &prev->values[0] : nullptr;
+            const Value *hi = (!bound.unbounded && bound.values.size() == 1)
+                                  ? &bound.values[0] : nullptr;
+            for (const auto *pred : key_preds) {
+                if (!RangeMayMatch(lo, hi, pred->comparison, pred->constant)) {
+                    may_match = false;
+                    break;
+                }
+            }
+        } else if (!bound.unbounded) {
+            // LIST: いずれかの値がすべての述語を満たせば残す
+            may_match = false;
+            for (const auto &value : bound.values) {
+                bool all = true;
+                for (const auto *pred : key_preds) {
+                    if (!CompareValues(value, pred->comparison, pred->constant)) {
+                        all = false;
+                        break;
+                    }
+                }
+                if (all) {
+                    may_match = true;
+                    break;
+                }
+            }
+        }
+        keep[entry.first] = may_match;
+        prev = &bound;
+    }
+
+    auto &parts = bind_data.partitions;
+    parts.erase(std::remove_if(parts.begin(), parts.end(),
+                               [&](const OraclePartitionInfo &part) {
+                                   return !keep[part.position];
+                               }),
+                parts.end());
+}
+
 } // namespace duckdb
@@ -0,0 +1,518 @@
+#include "oracle_query.hpp"
+#include "oracle_connection.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/string_map_set.hpp"
+#include <algorithm>
+
+namespace duckdb {
+
+// ─── OracleFetchSizing ───────────────────────────────────────────────────────
+
+// 1 往復で運ぶ量の目安。初期値は小さめにし、往復時間が支配的なら増やす
+static constexpr idx_t INITIAL_ROUND_TRIP_BYTES = 1024 * 1024;
+static constexpr idx_t MAX_ROUND_TRIP_BYTES     = 32 * 1024 * 1024;
+static constexpr idx_t MIN_FETCH_ROWS           = 16;
+static constexpr idx_t MAX_FETCH_ROWS           = 100000;
+
+// LOB を 1 回の readBytes で読む量の目安
+static constexpr uint64_t LOB_READ_BYTES = 1024 * 1024;
+
+// 1 チャンクの辞書に置く値の上限。超えたら辞書化の効果が薄いので諦める
+static constexpr idx_t MAX_DICTIONARY_SIZE = STANDARD_VECTOR_SIZE / 4;
+
+OracleFetchSizing OracleFetchSizing::FromParams(const OracleConnectionParameters &params) {
+    OracleFetchSizing sizing;
+    sizing.fixed_rows   = (idx_t)MaxValue<int>(params.fetch_size, 0);
+    sizing.buffer_bytes = (idx_t)MaxValue<int>(params.fetch_buffer_mb, 1) * 1024 * 1024;
+    return sizing;
+}
+
+idx_t OracleFetchSizing::InitialRows() const {
+    if (fixed_rows > 0) return fixed_rows;
+
+    idx_t row_bytes = avg_row_bytes > 0 ? avg_row_bytes
+                    : max_row_bytes > 0 ? MaxValue<idx_t>(max_row_bytes / 2, 1)
+                    : 256;
+    idx_t rows = INITIAL_ROUND_TRIP_BYTES / row_bytes;
+    if (max_row_bytes > 0) {
+        // 最大行長でもバッファ上限に収まる行数まで
+        rows = MinValue<idx_t>(rows, buffer_bytes / max_row_bytes);
+    }
+    return MinValue<idx_t>(MaxValue<idx_t>(rows, MIN_FETCH_ROWS), MAX_FETCH_ROWS);
+}
+
+// ─── OracleLobReader ─────────────────────────────────────────────────────────
+
+// LOB を読んだベクタに付けておく予約。チャンクがリセットされて文字列ヒープが
+// 解放されるときに一緒に破棄され、予算に返る
+struct OracleLobReservationBuffer : public VectorBuffer {
+    OracleLobReservationBuffer() : VectorBuffer(VectorBufferType::OPAQUE_BUFFER) {}
+
+    OracleMemoryReservation reservation;
+};
+
+string_t OracleLobReader::Read(dpiLob *lob, Vector &result) {
+    uint64_t size = 0;  // CLOB は文字数、BLOB はバイト数
+    conn_.ThrowIfError(dpiLob_getSize(lob, &size), "OracleLobReader::getSize");
+    if (size == 0) {
+        return string_t("", 0);
+    }
+    uint64_t buf_size = size;
+    conn_.ThrowIfError(dpiLob_getBufferSize(lob, size, &buf_size),
+                       "OracleLobReader::getBufferSize");
+    if (buf_size > NumericLimits<uint32_t>::Maximum()) {
+        throw InvalidInputException("Oracle LOB of %llu bytes exceeds the maximum string size",
+                                    (unsigned long long)buf_size);
+    }
+
+    // 1 回に読む量は LOB のチャンクサイズの倍数にそろえる
+    uint32_t chunk_size = 0;
+    conn_.ThrowIfError(dpiLob_getChunkSize(lob, &chunk_size), "OracleLobReader::getChunkSize");
+    chunk_size = MaxValue<uint32_t>(chunk_size, 1);
+    const uint64_t amount =
+        (uint64_t)chunk_size * MaxValue<uint64_t>(LOB_READ_BYTES / chunk_size, 1);
+
+    // ヒープの領域は DuckDB のバッファプールの外で取るので、確保する前に最大
+    // バイト長（マルチバイトの CLOB は 1 文字最大 4 バイト）を予算に予約する
+    if (budget_) {
+        auto holder = make_buffer<OracleLobReservationBuffer>();
+        holder->reservation.Reserve(budget_, (idx_t)buf_size, (idx_t)buf_size);
+        StringVector::AddBuffer(result, std::move(holder));
+    }
+
+    // ヒープに最大バイト長の領域を取り、チャンクごとに直接読む。マルチバイトの
+    // CLOB は実際のバイト長が読むまで分からないので、読み終えたら実際の長さに
+    // 縮める（末尾の未使用部分には触れないので、実メモリは読んだ分だけ）
+    auto target = StringVector::EmptyString(result, (idx_t)buf_size);
+    char *ptr = target.GetDataWriteable();
+    uint64_t written = 0;
+    for (uint64_t offset = 1; offset <= size;) {
+        uint64_t n   = MinValue<uint64_t>(amount, size - offset + 1);
+        uint64_t len = buf_size - written;
+        conn_.ThrowIfError(dpiLob_readBytes(lob, offset, n, ptr + written, &len),
+                           "OracleLobReader::readBytes");
+        if (len == 0) break;
+        written += len;
+        offset  += n;
+    }
+    if (written < buf_size) {
+        // マルチバイト文字を含む、または読んでいる間に短くなった
+        return string_t(ptr, (uint32_t)written);
+    }
+    target.Finalize();
+    return target;
+}
+
+// ─── OracleDictionaryColumn ──────────────────────────────────────────────────
+
+// 1 列分の辞書。Fetch ごとに作り直し、出力チャンクの行 → 辞書の位置を sel に持つ
+struct OracleDictionaryColumn {
+    idx_t column;
+    bool  trim_blanks;
+    bool  abandoned = false;  // 溢れた。このカーソルでは以後通常の変換
+
+    unique_ptr<Vector>  dict;   // 値の実体（ヒープも辞書側に持つ）
+    SelectionVector     sel;
+    string_map_t<sel_t> index;  // 値 → 辞書の位置（キーは dict の文字列）
+    idx_t size       = 0;
+    idx_t null_entry = DConstants::INVALID_INDEX;
+
+    OracleDictionaryColumn(idx_t column_p, bool trim_blanks_p)
+        : column(column_p), trim_blanks(trim_blanks_p) {}
+
+    void Reset() {
+        // 前のチャンクの辞書ベクトルが sel と dict を参照しているので新しく確保する
+        dict = make_uniq<Vector>(LogicalType::VARCHAR, MAX_DICTIONARY_SIZE + 1);
+        sel.Initialize(STANDARD_VECTOR_SIZE);
+        index.clear();
+        size       = 0;
+        null_entry = DConstants::INVALID_INDEX;
+    }
+
+    // data[0..count) を辞書に積み、sel[offset..] を埋める。積めた行数を返す
+    idx_t Append(dpiData *data, idx_t count, idx_t offset) {
+        auto entries = FlatVector::GetData<string_t>(*dict);
+        for (idx_t i = 0; i < count; ++i) {
+            if (data[i].isNull) {
+                if (null_entry == DConstants::INVALID_INDEX) {
+                    null_entry = size++;
+                    FlatVector::SetNull(*dict, null_entry, true);
+                }
+                sel.set_index(offset + i, null_entry);
+                continue;
+            }
+            const char *ptr = data[i].value.asBytes.ptr;
+            uint32_t    len = data[i].value.asBytes.length;
+            if (trim_blanks) {
+                while (len > 0 && ptr[len - 1] == ' ') --len;
+            }
+            auto it = index.find(string_t(ptr, len));
+            if (it != index.end()) {
+                sel.set_index(offset + i, it->second);
+                continue;
+            }
+            if (size >= MAX_DICTIONARY_SIZE) return i;
+            entries[size] = StringVector::AddStringOrBlob(*dict, ptr, len);
+            index.emplace(entries[size], (sel_t)size);
+            sel.set_index(offset + i, size++);
+        }
+        return count;
+    }
+
+    // 辞書に積んだ先頭 rows 行を result にフラットに書き戻して辞書化をやめる
+    void Abandon(Vector &result, idx_t rows) {
+        auto  entries  = FlatVector::GetData<string_t>(*dict);
+        auto  out      = FlatVector::GetData<string_t>(result);
+        auto &validity = FlatVector::Validity(result);
+        for (idx_t row = 0; row < rows; ++row) {
+            auto entry = sel.get_index(row);
+            if (entry == null_entry) {
+                validity.SetInvalid(row);
+            } else {
+                out[row] = entries[entry];
+            }
+        }
+        // 書き戻した文字列は辞書のヒープを指したまま
+        StringVector::AddHeapReference(result, *dict);
+        abandoned = true;
+        index.clear();
+    }
+};
+
+// ─── OracleQueryCursor ───────────────────────────────────────────────────────
+
+OracleQueryCursor::OracleQueryCursor(OracleConnection &conn, const std::string &sql,
+                                     const std::vector<LogicalType> &types,
+                                     const OracleFetchSizing &sizing,
+                                     const std::vector<OracleLobFallback> &lob_fallbacks,
+                                     const std::vector<idx_t> &dictionary_columns)
+    : conn_(conn), types_(types), lob_fallbacks_(lob_fallbacks),
+      dictionary_columns_(dictionary_columns), lob_reader_(conn, sizing.budget),
+      sizing_(sizing) {
+    conn_.ThrowIfError(dpiConn_prepareStmt(conn_.GetHandle(), 0, sql.c_str(),
+                                           (uint32_t)sql.size(), nullptr, 0, &stmt_),
+                       "OracleQueryCursor::prepareStmt");
+
+    // execute の往復で先頭の行まで受け取る
+    fetch_rows_ = (uint32_t)sizing_.InitialRows();
+
+    try {
+        conn_.ThrowIfError(dpiStmt_setPrefetchRows(stmt_, fetch_rows_),
+                           "OracleQueryCursor::setPrefetchRows");
+        conn_.ThrowIfError(dpiStmt_execute(stmt_, DPI_MODE_EXEC_DEFAULT, &num_cols_),
+                           "OracleQueryCursor::execute");
+        SetupColumns();
+    } catch (...) {
+        // コンストラクタ失敗時はデストラクタが呼ばれないのでここで解放
+        Close();
+        throw;
+    }
+}
+
+OracleQueryCursor::~OracleQueryCursor() {
+    Close();
+}
+
+// ─── SetupColumns ─────────────────────────────────────────────────────────────
+
+void OracleQueryCursor::SetupColumns() {
+    uint32_t num_converters = std::min<uint32_t>(num_cols_, (uint32_t)types_.size());
+    converters_.reserve(num_converters);
+    vars_.reserve(num_converters);
+    var_data_.reserve(num_converters);
+
+    // ロケータ列は出力列の後ろに並ぶ。範囲外のものは無視する
+    std::vector<OracleLobFallback> fallbacks;
+    for (const auto &fallback : lob_fallbacks_) {
+        if (fallback.column < num_converters && fallback.locator >= num_converters &&
+            fallback.locator < num_cols_) {
+            fallbacks.push_back(fallback);
+        }
+    }
+    lob_fallbacks_ = std::move(fallbacks);
+
+    std::vector<dpiQueryInfo> infos(num_converters);
+    idx_t row_bytes = 0;
+    for (uint32_t col = 0; col < num_converters; ++col) {
+        conn_.ThrowIfError(dpiStmt_getQueryInfo(stmt_, col + 1, &infos[col]),
+                           "OracleQueryCursor::getQueryInfo");
+        uint32_t inline_bytes = 0;
+        for (const auto &fallback : lob_fallbacks_) {
+            if (fallback.column == col) inline_bytes = fallback.inline_bytes;
+        }
+        if (inline_bytes > 0) {
+            converters_.push_back(OracleColumnConverter::CreateInlineLob(
+                infos[col].typeInfo, types_[col], inline_bytes));
+        } else {
+            converters_.push_back(
+                OracleColumnConverter::Create(infos[col].typeInfo, types_[col]));
+        }
+        if (conn_.GetParams().trim_char) {
+            converters_.back().EnableBlankTrim();
+        }
+        // 1 行あたりに確保されるバッファ（dpiData + 値の領域）
+        const auto &conv = converters_.back();
+        row_bytes += sizeof(dpiData) +
+                     (conv.native_type == DPI_NATIVE_TYPE_BYTES ? conv.define_size : 16);
+    }
+    row_bytes += lob_fallbacks_.size() * (sizeof(dpiData) + 16);
+
+    // 辞書化はフェッチ配列のバイト列をそのまま文字列にする列だけ
+    for (auto col : dictionary_columns_) {
+        if (col >= num_converters) continue;
+        const auto &conv = converters_[col];
+        bool is_string = conv.oracle_type == DPI_ORACLE_TYPE_VARCHAR ||
+                         conv.oracle_type == DPI_ORACLE_TYPE_NVARCHAR ||
+                         conv.oracle_type == DPI_ORACLE_TYPE_CHAR ||
+                         conv.oracle_type == DPI_ORACLE_TYPE_NCHAR;
+        if (is_string && conv.native_type == DPI_NATIVE_TYPE_BYTES &&
+            conv.type.id() == LogicalTypeId::VARCHAR) {
+            dictionaries_.push_back(make_uniq<OracleDictionaryColumn>(col, conv.trim_blanks));
+        }
+    }
+
+    // 配列長: 固定指定ならそれ、なければバッファ上限に収まる最大（広い表ほど小さい）
+    if (sizing_.fixed_rows > 0) {
+        array_size_ = (uint32_t)sizing_.fixed_rows;
+    } else {
+        idx_t rows = sizing_.buffer_bytes / MaxValue<idx_t>(row_bytes, 1);
+        array_size_ = (uint32_t)MinValue<idx_t>(MaxValue<idx_t>(rows, 1), MAX_FETCH_ROWS);
+    }
+    // 予算から define バッファを予約する。足りなければ配列を短くする
+    // （最低 MIN_FETCH_ROWS 行は確保する）
+    row_bytes = MaxValue<idx_t>(row_bytes, 1);
+    idx_t min_rows = MinValue<idx_t>(array_size_, MIN_FETCH_ROWS);
+    idx_t granted  = reservation_.Reserve(sizing_.budget, min_rows * row_bytes,
+                                          (idx_t)array_size_ * row_bytes);
+    array_size_ = (uint32_t)MinValue<idx_t>(array_size_,
+                                            MaxValue<idx_t>(granted / row_bytes, min_rows));
+    fetch_rows_ = MinValue<uint32_t>(MaxValue<uint32_t>(fetch_rows_, 1), array_size_);
+
+    // define 変数の配列長以下でなければ define できないので先に設定する
+    conn_.ThrowIfError(dpiStmt_setFetchArraySize(stmt_, fetch_rows_),
+                       "OracleQueryCursor::setFetchArraySize");
+
+    for (uint32_t col = 0; col < num_converters; ++col) {
+        const auto &conv = converters_[col];
+
+        // 列ごとに array_size_ 行分のバッファを持つ変数を作って define する
+        dpiVar  *var  = nullptr;
+        dpiData *data = nullptr;
+        conn_.ThrowIfError(dpiConn_newVar(conn_.GetHandle(), conv.define_type,
+                                          conv.native_type, array_size_,
+                                          conv.define_size, 1, 0,
+                                          infos[col].typeInfo.objectType, &var, &data),
+                           "OracleQueryCursor::newVar");
+        vars_.push_back(var);
+        var_data_.push_back(data);
+        conn_.ThrowIfError(dpiStmt_define(stmt_, col + 1, var),
+                           "OracleQueryCursor::define");
+    }
+
+    // ロケータ列（上限を超えた行だけ非 NULL）
+    for (const auto &fallback : lob_fallbacks_) {
+        dpiQueryInfo info;
+        conn_.ThrowIfError(dpiStmt_getQueryInfo(stmt_, (uint32_t)fallback.locator + 1, &info),
+                           "OracleQueryCursor::getQueryInfo");
+        dpiVar  *var  = nullptr;
+        dpiData *data = nullptr;
+        conn_.ThrowIfError(dpiConn_newVar(conn_.GetHandle(), info.typeInfo.oracleTypeNum,
+                                          DPI_NATIVE_TYPE_LOB, array_size_, 0, 0, 0,
+                                          nullptr, &var, &data),
+                           "OracleQueryCursor::newVar");
+        vars_.push_back(var);
+        var_data_.push_back(data);
+        conn_.ThrowIfError(dpiStmt_define(stmt_, (uint32_t)fallback.locator + 1, var),
+                           "OracleQueryCursor::define");
+    }
+}
+
+// ─── Close ────────────────────────────────────────────────────────────────────
+
+void OracleQueryCursor::Close() {
+    if (stmt_) {
+        // release で OCI 側のカーソルも閉じられる
+        dpiStmt_release(stmt_);
+        stmt_ = nullptr;
+    }
+    for (auto *var : vars_) {
+        dpiVar_release(var);
+    }
+    vars_.clear();
+    var_data_.clear();
+    reservation_.Release();
+    buffer_rows_ = buffer_pos_ = 0;
+    done_ = true;
+}
+
+// ─── FetchBatch ───────────────────────────────────────────────────────────────
+
+bool OracleQueryCursor::FetchBatch() {
+    auto start = std::chrono::steady_clock::now();
+    conn_.ThrowIfError(dpiStmt_fetchRows(stmt_, fetch_rows_, &buffer_index_,
+                                         &buffer_rows_, &more_rows_),
+                       "OracleQueryCursor::fetchRows");
+    buffer_pos_ = 0;
+    if (sizing_.fixed_rows == 0 && more_rows_) {
+        AdaptFetchRows(std::chrono::steady_clock::now() - start, buffer_rows_);
+    }
+    return buffer_rows_ > 0;
+}
+
+// ─── AdaptFetchRows ───────────────────────────────────────────────────────────
+
+void OracleQueryCursor::AdaptFetchRows(std::chrono::steady_clock::duration elapsed,
+                                       uint32_t rows) {
+    // 最初の呼び出しは execute 時に prefetch 済みの行を返すだけで往復しない
+    if (fetch_count_++ == 0 || rows < fetch_rows_) return;
+    min_rtt_ = MinValue(min_rtt_, elapsed);
+
+    // 実際に受け取った大きさで判断する（AVG_ROW_LEN は古いことも、列の幅から
+    // 見積もった値は大きすぎることもある）
+    idx_t batch_bytes = MeasureBatchBytes(rows);
+    idx_t row_bytes   = MaxValue<idx_t>(batch_bytes / rows, 1);
+
+    // 1 往復が MAX_ROUND_TRIP_BYTES を超えた、または RTT の 4 倍以上かかって
+    // 転送が支配的になったら行数を減らす（2〜4 倍の間は据え置き、増減を繰り返さない）
+    if (batch_bytes > MAX_ROUND_TRIP_BYTES || elapsed >= min_rtt_ * 4) {
+        idx_t next = batch_bytes > MAX_ROUND_TRIP_BYTES ? MAX_ROUND_TRIP_BYTES / row_bytes
+                                                        : fetch_rows_ / 2;
+        next = MaxValue<idx_t>(next, MinValue<idx_t>(MIN_FETCH_ROWS, array_size_));
+        if (next < fetch_rows_ && dpiStmt_setFetchArraySize(stmt_, (uint32_t)next) == DPI_SUCCESS) {
+            fetch_rows_ = (uint32_t)next;
+        }
+        return;
+    }
+
+    // 所要時間が RTT の 2 倍未満なら転送より往復の待ちが支配的なので、
+    // 1 往復の行数を倍にする
+    if (elapsed >= min_rtt_ * 2 || fetch_rows_ >= array_size_) return;
+    if ((idx_t)fetch_rows_ * 2 * row_bytes > MAX_ROUND_TRIP_BYTES) return;
+
+    uint32_t next = MinValue<uint32_t>(fetch_rows_ * 2, array_size_);
+    if (dpiStmt_setFetchArraySize(stmt_, next) == DPI_SUCCESS) {
+        fetch_rows_ = next;
+    }
+}
+
+// 直前の往復で受け取った rows 行の大きさ。可変長列は値の長さ、固定長列は
+// define の大きさで数える（ロケータ列と LOB の本体は含めない）
+idx_t OracleQueryCursor::MeasureBatchBytes(uint32_t rows) const {
+    idx_t bytes = 0;
+    for (idx_t col = 0; col < converters_.size(); ++col) {
+        const auto &conv = converters_[col];
+        if (conv.native_type != DPI_NATIVE_TYPE_BYTES) {
+            bytes += (idx_t)conv.define_size * rows;
+            continue;
+        }
+        const dpiData *data = var_data_[col] + buffer_index_;
+        for (uint32_t row = 0; row < rows; ++row) {
+            if (!data[row].isNull) bytes += data[row].value.asBytes.length;
+        }
+    }
+    return bytes;
+}
+
+// ─── ReadLobColumn ────────────────────────────────────────────────────────────
+
+void OracleQueryCursor::ReadLobColumn(dpiData *data, idx_t count, Vector &result,
+                                      idx_t offset) {
+    auto  out      = FlatVector::GetData<string_t>(result);
+    auto &validity = FlatVector::Validity(result);
+    for (idx_t row = 0; row < count; ++row) {
+        if (data[row].isNull) {
+            validity.SetInvalid(offset + row);
+            continue;
+        }
+        out[offset + row] = lob_reader_.Read(data[row].value.asLOB, result);
+    }
+}
+
+// ─── FillLobFallbacks ─────────────────────────────────────────────────────────
+
+void OracleQueryCursor::FillLobFallbacks(uint32_t start, idx_t count, DataChunk &output,
+                                         idx_t offset) {
+    for (idx_t i = 0; i < lob_fallbacks_.size(); ++i) {
+        const auto &fallback = lob_fallbacks_[i];
+        dpiData *locators = var_data_[converters_.size() + i] + start;
+        auto &result   = output.data[fallback.column];
+        auto  out      = FlatVector::GetData<string_t>(result);
+        auto &validity = FlatVector::Validity(result);
+        for (idx_t row = 0; row < count; ++row) {
+            if (locators[row].isNull) continue;
+            // インライン側は NULL になっているので、ロケータから読んで置き換える
+            out[offset + row] = lob_reader_.Read(locators[row].value.asLOB, result);
+            validity.SetValid(offset + row);
+        }
+    }
+}
+
+// ─── AppendDictionary ─────────────────────────────────────────────────────────
+
+void OracleQueryCursor::AppendDictionary(OracleDictionaryColumn &dict, dpiData *data,
+                                         idx_t count, Vector &result, idx_t offset) {
+    idx_t appended = dict.Append(data, count, offset);
+    if (appended == count) return;
+
+    // 統計より値がばらけていた。ここまでの行をフラットに戻し、残りは通常の変換
+    dict.Abandon(result, offset + appended);
+    converters_[dict.column].Convert(data + appended, count - appended, result,
+                                     offset + appended);
+}
+
+// ─── Fetch ────────────────────────────────────────────────────────────────────
+
+bool OracleQueryCursor::Fetch(DataChunk &output) {
+    if (done_) return false;
+
+    // このチャンクで辞書化する列（諦めた列は以後 converters_ で変換する）
+    std::vector<OracleDictionaryColumn *> dicts(converters_.size(), nullptr);
+    for (auto &dict : dictionaries_) {
+        if (dict->abandoned) continue;
+        dict->Reset();
+        dicts[dict->column] = dict.get();
+    }
+
+    idx_t row_count = 0;
+    while (row_count < STANDARD_VECTOR_SIZE) {
+        if (buffer_pos_ == buffer_rows_) {
+            if (!more_rows_ || !FetchBatch()) {
+                // 結果を読み切ったら即座にカーソルを閉じる
+                Close();
+                break;
+            }
+        }
+
+        // フェッチ配列の未消費部分を列ごとにまとめて変換する
+        idx_t count = MinValue<idx_t>(buffer_rows_ - buffer_pos_,
+                                      STANDARD_VECTOR_SIZE - row_count);
+        uint32_t start = buffer_index_ + buffer_pos_;
+        for (idx_t col = 0; col < converters_.size(); ++col) {
+            if (converters_[col].stream_lob) {
+                ReadLobColumn(var_data_[col] + start, count, output.data[col], row_count);
+            } else if (dicts[col] && !dicts[col]->abandoned) {
+                AppendDictionary(*dicts[col], var_data_[col] + start, count,
+                                 output.data[col], row_count);
+            } else {
+                converters_[col].Convert(var_data_[col] + start, count,
+                                         output.data[col], row_count);
+            }
+        }
+        if (!lob_fallbacks_.empty()) {
+            FillLobFallbacks(start, count, output, row_count);
+        }
+        buffer_pos_ += (uint32_t)count;
+        row_count   += count;
+    }
+
+    if (row_count > 0) {
+        for (auto *dict : dicts) {
+            if (!dict || dict->abandoned) continue;
+            output.data[dict->column].Slice(*dict->dict, dict->sel, row_count);
+        }
+    }
+    output.SetCardinality(row_count);
+    return row_count > 0;
+}
+
+} // namespace duckdb
@@ -1,9 +1,21 @@
 #include "oracle_scan.hpp"
+#include "oracle_catalog.hpp"
 #include "oracle_optimizer.hpp"
 #include "oracle_utils.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include <algorithm>
 #include <sstream>
 
+// テーブル関数が BLOCKED を返せる DuckDB（AsyncResult あり）なら、先読みが
+// 届くまでパイプラインを手放す。ない版では Scan の中で待つ
+#if defined(__has_include)
+#if __has_include("duckdb/parallel/async_result.hpp")
+#include "duckdb/parallel/async_result.hpp"
+#define ORACLE_ASYNC_SCAN 1
+#endif
+#endif
+
 namespace duckdb {
 
 // ─── OracleScanBindData ───────────────────────────────────────────────────────
@@ -11,15 +23,30 @@ namespace duckdb {
 unique_ptr<FunctionData> OracleScanBindData::Copy() const {
     auto copy = make_uniq<OracleScanBindData>();
     copy->pool   = pool;
+    copy->io_executor = io_executor;
+    copy->memory_budget = memory_budget;
+    copy->number_narrowing = number_narrowing;
     copy->schema = schema;
     copy->table  = table;
     copy->all_columns = all_columns;
     copy->all_types   = all_types;
+    copy->partition_scheme = partition_scheme;
+    copy->partitions  = partitions;
     copy->filters     = filters;
+    copy->predicates  = predicates;
+    copy->table_kind  = table_kind;
+    copy->hash_key    = hash_key;
+    copy->range_key   = range_key;
+    copy->avg_row_len = avg_row_len;
+    copy->lob_inline_size = lob_inline_size;
+    copy->dictionary_columns = dictionary_columns;
+    copy->server_casts = server_casts;
+    copy->spatial_srids = spatial_srids;
     copy->column_ids  = column_ids;
     copy->limit       = limit;
     copy->offset      = offset;
     copy->oracle_major_version = oracle_major_version;
+    copy->snapshot_scn = snapshot_scn;
     return std::move(copy);
 }
 
@@ -28,40 +55,162 @@ bool OracleScanBindData::Equals(const FunctionData &other) const {
     return schema == o.schema && table == o.table;
 }
 
-std::string OracleScanBindData::BuildSelectQuery() const {
-    std::ostringstream oss;
-    oss << "SELECT ";
+static bool IsGeometryColumn(const OracleColumnInfo &col) {
+    return col.oracle_type_name == "SDO_GEOMETRY";
+}
 
-    // Projection: column_ids が空なら全カラム
-    if (column_ids.empty()) {
-        oss << "*";
+// SDO_GEOMETRY は WKB の BLOB にして受け取るので、LOB と同じ扱いになる
+static bool IsLobColumn(const OracleColumnInfo &col) {
+    return col.oracle_type_name == "CLOB" || col.oracle_type_name == "NCLOB" ||
+           col.oracle_type_name == "BLOB" || IsGeometryColumn(col);
+}
+
+// SELECT リストに置く列の値の式。in_wkb_view なら SDO_GEOMETRY は内側のビューで
+// WKB にしてあるので、列名をそのまま参照する
+static std::string ColumnExpression(const OracleColumnInfo &col, bool in_wkb_view) {
+    std::string name = OracleUtils::QuoteIdentifier(col.name);
+    if (IsGeometryColumn(col) && !in_wkb_view) {
+        // オブジェクト型のまま受け取らず、サーバーで WKB にする
+        return "SDO_UTIL.TO_WKBGEOMETRY(" + name + ")";
+    }
+    return name;
+}
+
+std::string OracleScanBindData::BuildSelectQuery(const OracleScanTask *task) const {
+    std::string hint;
+    if (task && task->key_range) {
+        // キー範囲タスクは主キー索引の範囲スキャンで読ませる
+        hint = "INDEX_RS_ASC(" + OracleUtils::QuoteIdentifier(table) + ")";
+    }
+
+    std::vector<column_t> cids = column_ids;
+    if (cids.empty()) {
+        for (column_t cid = 0; cid < all_columns.size(); ++cid) cids.push_back(cid);
+    }
+    // インライン LOB の CASE は値を 2 回（ロケータ列を足せば 3 回）参照するので、
+    // SDO_GEOMETRY を読むときは WKB への変換を内側のビューで 1 回だけ行う
+    bool wkb_view = false;
+    if (lob_inline_size > 0) {
+        for (column_t cid : cids) {
+            if (cid < all_columns.size() && IsGeometryColumn(all_columns[cid])) {
+                wkb_view = true;
+            }
+        }
+    }
+
+    // Projection: column_ids が空なら全カラム（インライン LOB・SDO_GEOMETRY や
+    // サーバー側の変換があれば列挙する）
+    std::ostringstream list;
+    auto lob_fallbacks = GetLobFallbacks();
+    bool has_geometry  = std::any_of(all_columns.begin(), all_columns.end(), IsGeometryColumn);
+    if (column_ids.empty() && lob_fallbacks.empty() && server_casts.empty() && !has_geometry) {
+        list << "*";
     } else {
+        std::vector<column_t> emitted; // 出力列の位置 → cid
         bool first = true;
-        for (column_t cid : column_ids) {
+        for (column_t cid : cids) {
             if (cid == COLUMN_IDENTIFIER_ROW_ID) {
-                if (!first) oss << ", ";
-                oss << "ROWID";
+                // DuckDB の row id は BIGINT。Oracle の ROWID は数値化できないので
+                // COUNT(*) 等で要求された場合は NULL を返す
+                if (!first) list << ", ";
+                list << "NULL";
+                emitted.push_back(cid);
                 first = false;
             } else if (cid < all_columns.size()) {
-                if (!first) oss << ", ";
-                oss << OracleUtils::QuoteIdentifier(all_columns[cid].name);
+                if (!first) list << ", ";
+                emitted.push_back(cid);
+                std::string name = ColumnExpression(all_columns[cid], wkb_view);
+                if (IsLobColumn(all_columns[cid]) && lob_inline_size > 0) {
+                    list << "CASE WHEN DBMS_LOB.GETLENGTH(" << name << ") <= "
+                         << lob_inline_size << " THEN " << name << " END";
+                } else if (!server_casts.empty() && !server_casts[cid].empty()) {
+                    list << server_casts[cid] << "(" << name << ")";
+                } else {
+                    list << name;
+                }
                 first = false;
             }
         }
-        if (first) oss << "*";
+        // 上限を超えた LOB のロケータ列を末尾に足す（出力列の位置は変えない）
+        for (const auto &fallback : lob_fallbacks) {
+            std::string name = ColumnExpression(all_columns[emitted[fallback.column]], wkb_view);
+            list << ", CASE WHEN DBMS_LOB.GETLENGTH(" << name << ") > "
+                 << lob_inline_size << " THEN " << name << " END";
+        }
+        if (first) list << "*";
+    }
+
+    std::ostringstream oss;
+    oss << "SELECT ";
+    if (wkb_view) {
+        // 内側のビューには参照する列だけを置く（マージされると変換が外側に
+        // 展開されるので NO_MERGE）
+        oss << list.str() << " FROM (SELECT /*+ NO_MERGE " << hint << " */ ";
+        std::vector<bool> seen(all_columns.size(), false);
+        bool first = true;
+        for (column_t cid : cids) {
+            if (cid >= all_columns.size() || seen[cid]) continue;
+            seen[cid] = true;
+            if (!first) oss << ", ";
+            std::string name = OracleUtils::QuoteIdentifier(all_columns[cid].name);
+            if (IsGeometryColumn(all_columns[cid])) {
+                oss << ColumnExpression(all_columns[cid], false) << " " << name;
+            } else {
+                oss << name;
+            }
+            first = false;
+        }
+    } else {
+        if (!hint.empty()) oss << "/*+ " << hint << " */ ";
+        oss << list.str();
     }
 
     oss << " FROM " << OracleUtils::QuoteIdentifier(schema)
         << "." << OracleUtils::QuoteIdentifier(table);
+    if (task && !task->partition.empty()) {
+        oss << (task->is_subpartition ? " SUBPARTITION (" : " PARTITION (")
+            << OracleUtils::QuoteIdentifier(task->partition) << ")";
+    }
+    if (snapshot_scn != 0) {
+        // フラッシュバック問合せ（パーティション指定の後に置く）
+        oss << " AS OF SCN " << snapshot_scn;
+    }
 
-    // WHERE
-    if (!filters.empty()) {
+    // WHERE: pushdown フィルタ + タスクの範囲条件
+    std::vector<std::string> conditions = filters;
+    if (task) {
+        if (!task->rowid_lo.empty()) {
+            conditions.push_back("ROWID >= CHARTOROWID('" + task->rowid_lo + "')");
+        }
+        if (!task->rowid_hi.empty()) {
+            conditions.push_back("ROWID < CHARTOROWID('" + task->rowid_hi + "')");
+        }
+        if (task->key_range) {
+            std::string key = OracleUtils::QuoteIdentifier(range_key);
+            if (!task->key_lo.empty()) conditions.push_back(key + " >= " + task->key_lo);
+            if (!task->key_hi.empty()) conditions.push_back(key + " < " + task->key_hi);
+        }
+        if (task->hash_buckets > 0 && !hash_key.empty()) {
+            // ORA_HASH(NULL) は NULL なので、キーが NULL の行はバケット 0 に寄せる
+            std::string cond = "ORA_HASH(" + hash_key + ", " +
+                               std::to_string(task->hash_buckets - 1) + ") = " +
+                               std::to_string(task->hash_bucket);
+            if (task->hash_bucket == 0) {
+                cond = "(" + cond + " OR " + hash_key + " IS NULL)";
+            }
+            conditions.push_back(cond);
+        }
+    }
+    if (!conditions.empty()) {
         oss << " WHERE ";
-        for (size_t i = 0; i < filters.size(); ++i) {
+        for (size_t i = 0; i < conditions.size(); ++i) {
             if (i > 0) oss << " AND ";
-            oss << filters[i];
+            oss << conditions[i];
         }
     }
+    if (wkb_view) {
+        oss << ")";
+    }
 
     // LIMIT / OFFSET
     if (limit != DConstants::INVALID_INDEX) {
@@ -85,13 +234,454 @@ std::string OracleScanBindData::BuildSelectQuery() const {
     return oss.str();
 }
 
+std::vector<LogicalType> OracleScanBindData::GetProjectedTypes() const {
+    if (column_ids.empty()) {
+        return all_types;
+    }
+    std::vector<LogicalType> types;
+    for (column_t cid : column_ids) {
+        if (cid == COLUMN_IDENTIFIER_ROW_ID) {
+            types.push_back(LogicalType::ROW_TYPE);
+        } else if (cid < all_types.size()) {
+            types.push_back(all_types[cid]);
+        }
+    }
+    return types;
+}
+
+std::vector<OracleLobFallback> OracleScanBindData::GetLobFallbacks() const {
+    std::vector<OracleLobFallback> fallbacks;
+    if (lob_inline_size == 0) return fallbacks;
+
+    // 出力列の位置は GetProjectedTypes と同じ数え方（範囲外の列は飛ばす）
+    // CLOB の上限は文字数なので、define サイズは AL32UTF8 の 4 バイト換算
+    idx_t num_output = 0;
+    auto visit = [&](column_t cid) {
+        if (cid == COLUMN_IDENTIFIER_ROW_ID) {
+            num_output++;
+        } else if (cid < all_columns.size()) {
+            const auto &col = all_columns[cid];
+            if (IsLobColumn(col)) {
+                bool  is_binary = col.oracle_type_name == "BLOB" || IsGeometryColumn(col);
+                idx_t bytes = is_binary ? lob_inline_size : lob_inline_size * 4;
+                bytes = MinValue<idx_t>(bytes, (idx_t)NumericLimits<int32_t>::Maximum());
+                fallbacks.push_back({num_output, 0, (uint32_t)bytes});
+            }
+            num_output++;
+        }
+    };
+    if (column_ids.empty()) {
+        for (column_t cid = 0; cid < all_columns.size(); ++cid) visit(cid);
+    } else {
+        for (column_t cid : column_ids) visit(cid);
+    }
+
+    // ロケータ列は出力列の後ろに同じ順で並ぶ
+    for (idx_t i = 0; i < fallbacks.size(); ++i) {
+        fallbacks[i].locator = num_output + i;
+    }
+    return fallbacks;
+}
+
+std::vector<idx_t> OracleScanBindData::GetDictionaryColumns() const {
+    std::vector<idx_t> result;
+    if (dictionary_columns.empty()) return result;
+
+    // 出力列の位置は GetProjectedTypes と同じ数え方
+    idx_t num_output = 0;
+    auto visit = [&](column_t cid) {
+        if (cid == COLUMN_IDENTIFIER_ROW_ID) {
+            num_output++;
+        } else if (cid < all_columns.size()) {
+            if (dictionary_columns[cid]) result.push_back(num_output);
+            num_output++;
+        }
+    };
+    if (column_ids.empty()) {
+        for (column_t cid = 0; cid < all_columns.size(); ++cid) visit(cid);
+    } else {
+        for (column_t cid : column_ids) visit(cid);
+    }
+    return result;
+}
+
+// 列の定義上の最大バイト数（可変長は最大長、文字は AL32UTF8 の 4 バイト換算）
+static idx_t MaxColumnBytes(const OracleColumnInfo &col) {
+    const std::string &type = col.oracle_type_name;
+    if (type.find("CHAR") != std::string::npos) {
+        return (idx_t)MaxValue<int32_t>(col.char_length, 1) * 4;
+    }
+    if (type == "NUMBER" || type == "FLOAT") return 22;
+    if (type == "DATE") return 7;
+    if (type.compare(0, 9, "TIMESTAMP") == 0) return 13;
+    if (type == "RAW") return 2000;
+    if (type == "VECTOR") {
+        // 要素は最大 8 バイト（次元数が可変なら目安として 1024 次元）
+        return (idx_t)(col.vector_dimensions > 0 ? col.vector_dimensions : 1024) * 8;
+    }
+    if (type == "JSON") return 4000;  // OSON の値は行外にあることもある。目安
+    return 64;
+}
+
+OracleFetchSizing OracleScanBindData::GetFetchSizing() const {
+    auto sizing = OracleFetchSizing::FromParams(pool->GetParams());
+    sizing.budget = memory_budget.get();
+
+    idx_t total_bytes = 0;
+    for (const auto &col : all_columns) {
+        total_bytes += MaxColumnBytes(col);
+    }
+    idx_t projected_bytes = 0;
+    if (column_ids.empty()) {
+        projected_bytes = total_bytes;
+    } else {
+        for (column_t cid : column_ids) {
+            if (cid < all_columns.size()) {
+                projected_bytes += MaxColumnBytes(all_columns[cid]);
+            }
+        }
+    }
+    sizing.max_row_bytes = projected_bytes;
+    if (avg_row_len > 0 && total_bytes > 0) {
+        // AVG_ROW_LEN は全列分なので、射影した列の割合で按分する
+        sizing.avg_row_bytes = MaxValue<idx_t>(
+            (idx_t)((double)avg_row_len * projected_bytes / total_bytes), 1);
+    }
+    return sizing;
+}
+
 // ─── GlobalState ──────────────────────────────────────────────────────────────
 
-OracleScanGlobalState::OracleScanGlobalState(const OracleScanBindData &bind_data) {
-    // 単純実装: タスクは 1 つ（並列化拡張は Phase 3）
-    ScanTask task;
-    tasks.push_back(task);
-    max_threads = 1;
+OracleScanGlobalState::OracleScanGlobalState(ClientContext &context,
+                                             const OracleScanBindData &bind_data) {
+    const auto &params = bind_data.pool->GetParams();
+    idx_t num_threads = (idx_t)TaskScheduler::GetScheduler(context).NumberOfThreads();
+    if (params.max_threads > 0) {
+        num_threads = MinValue<idx_t>(num_threads, (idx_t)params.max_threads);
+    }
+
+    // 全パーティションが刈り込まれたら何も読まない
+    if (bind_data.IsPartitioned() && bind_data.partitions.empty()) {
+        max_threads = 1;
+        return;
+    }
+
+    // LIMIT / OFFSET は 1 本の SELECT でしか正しく評価できないので単一タスク
+    if (num_threads > 1 && bind_data.limit == DConstants::INVALID_INDEX &&
+        !bind_data.partitions.empty()) {
+        auto conn = bind_data.pool->Acquire();
+        PlanPartitionTasks(bind_data, *conn, num_threads);
+        bind_data.pool->Release(conn);
+    } else if (num_threads > 1 && bind_data.limit == DConstants::INVALID_INDEX) {
+        auto conn = bind_data.pool->Acquire();
+        try {
+            // キー範囲 → ハッシュバケット → ROWID 範囲の順に、分割できた方法を使う
+            if (!bind_data.range_key.empty()) {
+                PlanKeyRangeTasks(bind_data, *conn, num_threads);
+            }
+            if (tasks.empty() && !bind_data.hash_key.empty()) {
+                PlanHashTasks(bind_data, *conn, num_threads);
+            }
+            if (tasks.empty() && bind_data.table_kind == OracleTableKind::HEAP_TABLE) {
+                PlanRowidTasks(bind_data, *conn, num_threads);
+            }
+        } catch (const std::exception &) {
+            // 分割に失敗しても単一タスクで読めるので続行する
+            tasks.clear();
+        }
+        bind_data.pool->Release(conn);
+    }
+
+    if (tasks.empty()) {
+        tasks.push_back(ScanTask());
+    }
+    max_threads = MinValue<idx_t>(tasks.size(), num_threads);
+    BuildRanges(max_threads);
+}
+
+// ─── BuildRanges ──────────────────────────────────────────────────────────────
+
+void OracleScanGlobalState::BuildRanges(idx_t num_threads) {
+    idx_t per_range = 1;
+    if (contiguous_tasks) {
+        per_range = (tasks.size() + num_threads - 1) / num_threads;
+    }
+    for (idx_t begin = 0; begin < tasks.size(); begin += per_range) {
+        auto range = make_uniq<WorkRange>();
+        range->next = begin;
+        range->end  = MinValue<idx_t>(begin + per_range, tasks.size());
+        ranges.push_back(std::move(range));
+    }
+    // 奪ったタスクの受け皿として、全ワーカーが自分の範囲を持てるようにしておく
+    while (ranges.size() < num_threads) {
+        ranges.push_back(make_uniq<WorkRange>());
+    }
+}
+
+// ─── PlanPartitionTasks ───────────────────────────────────────────────────────
+
+void OracleScanGlobalState::PlanPartitionTasks(const OracleScanBindData &bind_data,
+                                               OracleConnection &conn, idx_t num_threads) {
+    const auto &params = bind_data.pool->GetParams();
+    const idx_t MB = 1024 * 1024;
+    const idx_t threshold = (idx_t)MaxValue<int>(params.parallel_threshold_mb, 0) * MB;
+
+    idx_t total_bytes = 0;
+    for (const auto &part : bind_data.partitions) total_bytes += part.bytes;
+    if (total_bytes < threshold) return;
+
+    // 大きいものから割り当てて、最後に残る長いタスクで待たされないようにする
+    auto partitions = bind_data.partitions;
+    std::stable_sort(partitions.begin(), partitions.end(),
+                     [](const OraclePartitionInfo &a, const OraclePartitionInfo &b) {
+                         return a.bytes > b.bytes;
+                     });
+
+    // 大きなパーティションはエクステントから ROWID 範囲のサブタスクに分け、
+    // 1 つのパーティションが 1 ワーカーに残らないようにする（奪える単位を作る）
+    idx_t task_bytes = (idx_t)MaxValue<int>(params.task_size_mb, 1) * MB;
+    task_bytes = MinValue<idx_t>(task_bytes,
+                                 MaxValue<idx_t>(total_bytes / (num_threads * 4), MB));
+    auto extents = conn.GetPartitionExtents(bind_data.schema, bind_data.table);
+
+    for (const auto &part : partitions) {
+        ScanTask task;
+        task.partition       = part.name;
+        task.is_subpartition = part.is_subpartition;
+        task.bytes           = part.bytes;
+        auto entry = extents.find(part.name);
+        if (part.bytes > task_bytes && entry != extents.end()) {
+            AppendExtentTasks(task, entry->second, task_bytes);
+            contiguous_tasks = true;
+        } else {
+            tasks.push_back(std::move(task));
+        }
+    }
+}
+
+// ─── AppendExtentTasks ────────────────────────────────────────────────────────
+
+void OracleScanGlobalState::AppendExtentTasks(const ScanTask &base,
+                                              const std::vector<OracleExtentInfo> &extents,
+                                              idx_t task_bytes) {
+    // (ファイル, ブロック) 順に並んだ連続エクステントを task_bytes ごとにまとめる。
+    // 間に他セグメントのブロックが挟まっても、データオブジェクト番号が違うので
+    // そのブロックの行が範囲に入ることはない
+    idx_t first = tasks.size();
+    ScanTask task = base;
+    task.bytes = 0;
+    for (const auto &ext : extents) {
+        if (task.bytes == 0) task.rowid_lo = ext.rowid_lo;
+        task.rowid_hi = ext.rowid_hi;
+        task.bytes   += ext.bytes;
+        if (task.bytes >= task_bytes) {
+            tasks.push_back(task);
+            task = base;
+            task.bytes = 0;
+        }
+    }
+    if (task.bytes > 0) tasks.push_back(task);
+    if (tasks.size() == first) return;
+
+    // 先頭・末尾は開区間にして、計画後に追加されたエクステントも取りこぼさない
+    tasks[first].rowid_lo.clear();
+    tasks.back().rowid_hi.clear();
+}
+
+// ─── PlanKeyRangeTasks ────────────────────────────────────────────────────────
+
+void OracleScanGlobalState::PlanKeyRangeTasks(const OracleScanBindData &bind_data,
+                                              OracleConnection &conn, idx_t num_threads) {
+    contiguous_tasks = true;
+    const auto &params = conn.GetParams();
+    const idx_t MB = 1024 * 1024;
+    const idx_t threshold = (idx_t)MaxValue<int>(params.parallel_threshold_mb, 0) * MB;
+
+    idx_t total_bytes = conn.GetTableSizeEstimate(bind_data.schema, bind_data.table);
+    if (total_bytes < threshold) return;
+
+    bool is_date = false;
+    for (const auto &col : bind_data.all_columns) {
+        if (col.name == bind_data.range_key) {
+            is_date = col.oracle_type_name == "DATE" ||
+                      col.oracle_type_name.rfind("TIMESTAMP", 0) == 0;
+            break;
+        }
+    }
+
+    // ROWID 分割と同じくスレッドあたり数タスクを目安にする（ヒストグラムの
+    // バケット数を超えて細かくはできない）
+    idx_t task_bytes = (idx_t)MaxValue<int>(params.task_size_mb, 1) * MB;
+    task_bytes = MinValue<idx_t>(task_bytes,
+                                 MaxValue<idx_t>(total_bytes / (num_threads * 4), MB));
+    idx_t num_ranges = MaxValue<idx_t>(num_threads, total_bytes / task_bytes + 1);
+    num_ranges = MinValue<idx_t>(num_ranges, 256);
+
+    auto bounds = conn.GetKeyRangeBoundaries(bind_data.schema, bind_data.table,
+                                             bind_data.range_key, is_date, num_ranges);
+    if (bounds.empty()) return;
+
+    std::string lo;
+    for (const auto &hi : bounds) {
+        ScanTask task;
+        task.key_range = true;
+        task.key_lo    = lo;
+        task.key_hi    = hi;
+        task.bytes     = total_bytes / (bounds.size() + 1);
+        tasks.push_back(std::move(task));
+        lo = hi;
+    }
+    ScanTask last;
+    last.key_range = true;
+    last.key_lo    = lo;
+    last.bytes     = total_bytes / (bounds.size() + 1);
+    tasks.push_back(std::move(last));
+}
+
+// ─── PlanHashTasks ────────────────────────────────────────────────────────────
+
+void OracleScanGlobalState::PlanHashTasks(const OracleScanBindData &bind_data,
+                                          OracleConnection &conn, idx_t num_threads) {
+    const auto &params = conn.GetParams();
+
+    // IOT は統計でサイズが分かるので閾値を適用する。ビューは大きさが分からないので常に分割
+    idx_t total_bytes = 0;
+    if (bind_data.table_kind == OracleTableKind::IOT) {
+        total_bytes = conn.GetTableSizeEstimate(bind_data.schema, bind_data.table);
+        const idx_t threshold =
+            (idx_t)MaxValue<int>(params.parallel_threshold_mb, 0) * 1024 * 1024;
+        if (total_bytes < threshold) return;
+    }
+
+    // 各バケットが元の全体を走査するので、バケット数はスレッド数に揃える
+    idx_t num_buckets = params.hash_buckets > 0 ? (idx_t)params.hash_buckets : num_threads;
+    if (num_buckets < 2) return;
+    for (idx_t bucket = 0; bucket < num_buckets; ++bucket) {
+        ScanTask task;
+        task.hash_bucket  = bucket;
+        task.hash_buckets = num_buckets;
+        task.bytes        = total_bytes / num_buckets;
+        tasks.push_back(std::move(task));
+    }
+}
+
+// ─── PlanRowidTasks ───────────────────────────────────────────────────────────
+
+void OracleScanGlobalState::PlanRowidTasks(const OracleScanBindData &bind_data,
+                                           OracleConnection &conn, idx_t num_threads) {
+    contiguous_tasks = true;
+    const auto &params = conn.GetParams();
+    const idx_t MB = 1024 * 1024;
+    const idx_t threshold = (idx_t)MaxValue<int>(params.parallel_threshold_mb, 0) * MB;
+
+    auto extents = conn.GetTableExtents(bind_data.schema, bind_data.table);
+    if (!extents.empty()) {
+        idx_t total_bytes = 0;
+        for (const auto &ext : extents) total_bytes += ext.bytes;
+        if (total_bytes < threshold) return;
+
+        // スレッドあたり数タスクになるよう task_size_mb を上限に縮める
+        idx_t task_bytes = (idx_t)MaxValue<int>(params.task_size_mb, 1) * MB;
+        task_bytes = MinValue<idx_t>(task_bytes,
+                                     MaxValue<idx_t>(total_bytes / (num_threads * 4), MB));
+
+        AppendExtentTasks(ScanTask(), extents, task_bytes);
+        return;
+    }
+
+    // エクステントが見えない場合は統計でサイズを見積り、サンプリングで境界を求める
+    idx_t total_bytes = conn.GetTableSizeEstimate(bind_data.schema, bind_data.table);
+    if (total_bytes == 0 || total_bytes < threshold) return;
+
+    idx_t task_bytes = (idx_t)MaxValue<int>(params.task_size_mb, 1) * MB;
+    idx_t num_ranges = MaxValue<idx_t>((total_bytes + task_bytes - 1) / task_bytes,
+                                       num_threads * 2);
+    auto bounds = conn.GetSampledRowidBoundaries(bind_data.schema, bind_data.table,
+                                                 num_ranges);
+    std::string lo;
+    for (const auto &hi : bounds) {
+        ScanTask task;
+        task.rowid_lo = lo;
+        task.rowid_hi = hi;
+        task.bytes    = total_bytes / num_ranges;
+        tasks.push_back(task);
+        lo = hi;
+    }
+    if (!tasks.empty()) {
+        ScanTask last;
+        last.rowid_lo = lo;
+        last.bytes    = total_bytes / num_ranges;
+        tasks.push_back(last);
+    }
+}
+
+// ─── NextTask ─────────────────────────────────────────────────────────────────
+
+bool OracleScanGlobalState::NextTask(idx_t &range, ScanTask &task) {
+    while (true) {
+        if (range != DConstants::INVALID_INDEX) {
+            // 自分の範囲の先頭を取る（ロックは奪いに来たワーカーとしか競合しない）
+            auto &own = *ranges[range];
+            std::lock_guard<std::mutex> lk(own.lock);
+            idx_t next = own.next.load(std::memory_order_relaxed);
+            if (next < own.end.load(std::memory_order_relaxed)) {
+                own.next.store(next + 1, std::memory_order_relaxed);
+                task = tasks[next];
+                return true;
+            }
+        }
+
+        // 誰も持っていない範囲があればそれを取る
+        idx_t fresh = next_range.fetch_add(1);
+        if (fresh < ranges.size()) {
+            range = fresh;
+            continue;
+        }
+        if (range == DConstants::INVALID_INDEX || !Steal(range)) {
+            return false;
+        }
+    }
+}
+
+// ─── Steal ────────────────────────────────────────────────────────────────────
+
+bool OracleScanGlobalState::Steal(idx_t own) {
+    while (true) {
+        // 残りの最も多い範囲を探す（ロックなしの目安）
+        idx_t victim = DConstants::INVALID_INDEX;
+        idx_t best   = 0;
+        for (idx_t i = 0; i < ranges.size(); ++i) {
+            if (i == own) continue;
+            idx_t remaining = ranges[i]->Remaining();
+            if (remaining > best) {
+                best   = remaining;
+                victim = i;
+            }
+        }
+        if (victim == DConstants::INVALID_INDEX) {
+            return false;
+        }
+
+        // 未着手部分の後半 [mid, end) を切り取る。持ち主が実行中のタスクと
+        // 先頭側は持ち主に残る。2 つのロックを同時に持たないのでデッドロックしない
+        idx_t lo, hi;
+        {
+            auto &from = *ranges[victim];
+            std::lock_guard<std::mutex> lk(from.lock);
+            idx_t next = from.next.load(std::memory_order_relaxed);
+            hi = from.end.load(std::memory_order_relaxed);
+            if (next >= hi) {
+                continue; // 調べている間に空になった
+            }
+            lo = next + (hi - next) / 2;
+            from.end.store(lo, std::memory_order_relaxed);
+        }
+        auto &to = *ranges[own];
+        std::lock_guard<std::mutex> lk(to.lock);
+        to.next.store(lo, std::memory_order_relaxed);
+        to.end.store(hi, std::memory_order_relaxed);
+        return true;
+    }
 }
 
 // ─── Bind ─────────────────────────────────────────────────────────────────────
@@ -114,8 +704,11 @@ OracleScan::Bind(ClientContext &context, TableFunctionBindInput &input,
 
 unique_ptr<GlobalTableFunctionState>
 OracleScan::InitGlobal(ClientContext &context, TableFunctionInitInput &input) {
-    const auto &bind_data = input.bind_data->Cast<OracleScanBindData>();
-    return make_uniq<OracleScanGlobalState>(bind_data);
+    // Projection Pushdown: DuckDB が要求するカラムを bind_data に反映する
+    // （bind_data は Bind 時に Copy されたこのスキャン専用のインスタンス）
+    auto &bind_data = input.bind_data->CastNoConst<OracleScanBindData>();
+    bind_data.column_ids = input.column_ids;
+    return make_uniq<OracleScanGlobalState>(context, bind_data);
 }
 
 // ─── InitLocal ────────────────────────────────────────────────────────────────
@@ -124,51 +717,151 @@ unique_ptr<LocalTableFunctionState>
 OracleScan::InitLocal(ExecutionContext &context, TableFunctionInitInput &input,
                        GlobalTableFunctionState *gstate) {
     const auto &bind_data = input.bind_data->Cast<OracleScanBindData>();
+    auto &global_st = gstate->Cast<OracleScanGlobalState>();
     auto local = make_uniq<OracleScanLocalState>();
 
-    // プールから接続を取得
+    // プールから接続を取得（LocalState の破棄時に返却）
+    local->pool       = bind_data.pool;
     local->connection = bind_data.pool->Acquire();
+    local->projected_types = bind_data.GetProjectedTypes();
+    local->fetch_sizing    = bind_data.GetFetchSizing();
+    local->lob_fallbacks   = bind_data.GetLobFallbacks();
+    local->dictionary_columns = bind_data.GetDictionaryColumns();
+
+    // フェッチと変換は共有 I/O スレッドに任せ、Scan は出来上がったチャンクを
+    // 受け取るだけにする。bind_data と global_state は LocalState より長く生きる
+    const int prefetch_chunks = local->connection->GetParams().prefetch_chunks;
+    if (prefetch_chunks > 0 && bind_data.io_executor) {
+        local->prefetching = true;
+        auto *local_ptr = local.get();
+        auto conn = local->connection;
+        // 1 チャンクの大きさの見積もり: 固定長部分 + 可変長部分（平均行長）
+        idx_t row_bytes = local->fetch_sizing.avg_row_bytes;
+        for (const auto &type : local->projected_types) {
+            row_bytes += GetTypeIdSize(type.InternalType());
+        }
+        local->stream = bind_data.io_executor->Start(
+            &context.client, local->projected_types, (idx_t)prefetch_chunks,
+            bind_data.memory_budget.get(), row_bytes * STANDARD_VECTOR_SIZE,
+            [&bind_data, &global_st, local_ptr](DataChunk &chunk) {
+                return FillChunk(bind_data, global_st, *local_ptr, chunk);
+            },
+            [conn]() { conn->BreakExecution(); });
+    }
     return std::move(local);
 }
 
+OracleScanLocalState::~OracleScanLocalState() {
+    // I/O スレッドでの実行が終わるのを待ってから、途中で打ち切られた場合
+    // （LIMIT 等）もカーソルを閉じて接続を返す
+    if (stream) {
+        stream->Cancel();
+        stream.reset();
+    }
+    cursor.reset();
+    if (pool && connection) {
+        pool->Release(std::move(connection));
+    }
+}
+
+// ─── FillChunk ────────────────────────────────────────────────────────────────
+
+bool OracleScan::FillChunk(const OracleScanBindData &bind_data,
+                           OracleScanGlobalState &global_st,
+                           OracleScanLocalState &local, DataChunk &output) {
+    while (!local.done) {
+        // カーソルがなければ次のタスクを取って実行し、以降は同じカーソルから続きを読む
+        if (!local.cursor) {
+            OracleScanTask task;
+            if (!global_st.NextTask(local.work_range, task)) {
+                // 担当するタスクがもうないので接続を早めにプールへ返す
+                // （先読み中は I/O スレッドでの実行が終わった後に Scan 側で返す）
+                local.done = true;
+                if (!local.prefetching) {
+                    local.pool->Release(std::move(local.connection));
+                }
+                return false;
+            }
+            local.cursor = make_uniq<OracleQueryCursor>(
+                *local.connection, bind_data.BuildSelectQuery(&task),
+                local.projected_types, local.fetch_sizing, local.lob_fallbacks,
+                local.dictionary_columns);
+        }
+
+        bool fetched;
+        try {
+            fetched = local.cursor->Fetch(output);
+        } catch (const OracleNarrowingException &) {
+            // 統計から整数化した列に小数・桁あふれがあった。出力の型は変えられない
+            // ので、この問い合わせは失敗させ、次の問い合わせからは表を読み直して
+            // DOUBLE に戻す（JSON / VECTOR など他の変換エラーでは取り消さない）
+            if (bind_data.number_narrowing) {
+                bind_data.number_narrowing->Reject(
+                    OracleUtils::ToUpper(bind_data.schema) + "." +
+                    OracleUtils::ToUpper(bind_data.table));
+            }
+            throw;
+        }
+        if (fetched) {
+            return true;
+        }
+        local.cursor.reset(); // このタスクは読み切った
+    }
+    return false;
+}
+
 // ─── Scan ─────────────────────────────────────────────────────────────────────
 
+#ifdef ORACLE_ASYNC_SCAN
+// BLOCKED にしたスキャンを再開させる非同期タスク。I/O スレッドがチャンクを
+// 積むと Wait から戻り、DuckDB が止めていたパイプラインを起こす。
+// このタスク自体はスケジューラのスレッドで待つので、待つスレッドが
+// パイプラインから非同期タスクに移るだけ（テーブル関数は InterruptState を
+// 受け取れないので、I/O スレッドから直接起こせない）
+class OracleStreamWaitTask : public AsyncTask {
+public:
+    explicit OracleStreamWaitTask(std::shared_ptr<OracleIOStream> stream)
+        : stream_(std::move(stream)) {}
+
+    void Execute() override {
+        stream_->Wait();
+    }
+
+private:
+    std::shared_ptr<OracleIOStream> stream_;
+};
+#endif
+
 void OracleScan::Scan(ClientContext &context, TableFunctionInput &data,
                        DataChunk &output) {
     auto &bind_data  = data.bind_data->Cast<OracleScanBindData>();
     auto &local      = data.local_state->Cast<OracleScanLocalState>();
     auto &global_st  = data.global_state->Cast<OracleScanGlobalState>();
 
-    if (local.done) return;
-
-    // 列の型リストを組み立てる（column_ids によるプロジェクション）
-    std::vector<LogicalType> projected_types;
-    if (bind_data.column_ids.empty()) {
-        projected_types = bind_data.all_types;
-    } else {
-        for (column_t cid : bind_data.column_ids) {
-            if (cid == COLUMN_IDENTIFIER_ROW_ID) {
-                projected_types.push_back(LogicalType::VARCHAR);
-            } else if (cid < bind_data.all_types.size()) {
-                projected_types.push_back(bind_data.all_types[cid]);
+    if (local.stream) {
+#ifdef ORACLE_ASYNC_SCAN
+        auto status = local.stream->TryNext(output);
+        if (status == OracleIOStatus::PENDING) {
+            // まだ届いていない。ワーカースレッドは他のパイプラインに回す
+            output.SetCardinality(0);
+            vector<unique_ptr<AsyncTask>> tasks;
+            tasks.push_back(make_uniq<OracleStreamWaitTask>(local.stream));
+            data.async_result = AsyncResult(std::move(tasks));
+            return;
+        }
+#else
+        auto status = local.stream->Next(output) ? OracleIOStatus::READY
+                                                 : OracleIOStatus::FINISHED;
+#endif
+        if (status == OracleIOStatus::FINISHED) {
+            output.SetCardinality(0);
+            if (local.connection) {
+                local.pool->Release(std::move(local.connection));
             }
         }
+        return;
     }
-
-    std::string sql = bind_data.BuildSelectQuery();
-    bool got_chunk = false;
-
-    local.connection->ExecuteQuery(sql, projected_types,
-                                   bind_data.pool->Acquire()->GetParams().fetch_size,
-                                   [&](DataChunk &chunk) -> bool {
-        output.Move(chunk);
-        got_chunk = true;
-        return false; // 1チャンクずつ返す
-    });
-
-    if (!got_chunk) {
-        local.done = true;
-    }
+    FillChunk(bind_data, global_st, local, output);
 }
 
 // ─── Cardinality ──────────────────────────────────────────────────────────────
@@ -188,13 +881,32 @@ void OracleScan::ComplexFilter(ClientContext &context,
                                 vector<unique_ptr<Expression>> &filters) {
     auto &bind_data = bind_data_p->Cast<OracleScanBindData>();
 
-    // カラム名リストを構築
+    // フィルタ中のカラム参照は get のカラム ID 列の位置を指すので、
+    // その位置ごとの Oracle カラム名を並べる（ROWID は pushdown しない）
     std::vector<std::string> col_names;
-    for (const auto &col : bind_data.all_columns) {
-        col_names.push_back(col.name);
+    for (const auto &col_id : get.GetColumnIds()) {
+        if (col_id.IsRowIdColumn() ||
+            col_id.GetPrimaryIndex() >= bind_data.all_columns.size()) {
+            col_names.emplace_back();
+        } else {
+            col_names.push_back(bind_data.all_columns[col_id.GetPrimaryIndex()].name);
+        }
     }
 
     OracleFilterPushdown::PushdownFilters(bind_data, col_names, filters);
+    OracleFilterPushdown::PushdownSpatialFilters(context, bind_data, col_names, filters);
+    OracleFilterPushdown::PrunePartitions(bind_data);
+}
+
+// ─── ToString ─────────────────────────────────────────────────────────────────
+
+InsertionOrderPreservingMap<string> OracleScan::ToString(TableFunctionToStringInput &input) {
+    InsertionOrderPreservingMap<string> result;
+    auto &bind_data = input.bind_data->Cast<OracleScanBindData>();
+    result["Table"] = bind_data.schema + "." + bind_data.table;
+    // 分割前（タスクの範囲条件なし）の SELECT 文
+    result["Oracle Query"] = bind_data.BuildSelectQuery();
+    return result;
 }
 
 // ─── GetFunction ──────────────────────────────────────────────────────────────
@@ -205,6 +917,7 @@ TableFunction OracleScan::GetFunction() {
     func.init_global   = OracleScan::InitGlobal;
     func.init_local    = OracleScan::InitLocal;
     func.cardinality   = OracleScan::Cardinality;
+    func.to_string     = OracleScan::ToString;
     func.pushdown_complex_filter = OracleScan::ComplexFilter;
     func.projection_pushdown = true;
     return func;
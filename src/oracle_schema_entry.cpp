@@ -12,27 +12,89 @@ OracleSchemaEntry::OracleSchemaEntry(Catalog &catalog, CreateSchemaInfo &info,
                                        OracleConnectionPool &pool)
     : SchemaCatalogEntry(catalog, info), pool_(pool) {}
 
+// ─── NarrowNumberColumns ──────────────────────────────────────────────────────
+
+// 精度なし NUMBER のうち統計上整数の列を NUMBER(p, 0) として扱う。
+// 判定結果はカタログに残し、表を読み直しても再判定しない
+static void NarrowNumberColumns(OracleNumberNarrowing &narrowing, OracleConnection &conn,
+                                const std::string &schema, const std::string &table,
+                                std::vector<OracleColumnInfo> &columns) {
+    std::string key = OracleUtils::ToUpper(schema) + "." + table;
+    OracleNumberNarrowing::columns_t integral;
+    if (!narrowing.Get(key, integral)) {
+        try {
+            integral = conn.GetIntegralNumberColumns(schema, table);
+        } catch (const std::exception &) {
+            integral.clear(); // 統計を参照できなければ従来どおり DOUBLE
+        }
+        narrowing.Set(key, integral);
+    }
+    for (auto &col : columns) {
+        auto it = integral.find(col.name);
+        if (it == integral.end() || col.oracle_type_name != "NUMBER" ||
+            col.precision != 0 || col.scale != -127) {
+            continue;
+        }
+        col.precision = it->second;
+        col.scale     = 0;
+        col.narrowed  = true;
+    }
+}
+
+// ─── ApplyJsonSchemas ─────────────────────────────────────────────────────────
+
+// JSON_SCHEMAS に挙がった JSON 列は JSON テキストではなく指定の型で返す
+static void ApplyJsonSchemas(const OracleConnectionParameters &params,
+                             const std::string &schema, const std::string &table,
+                             std::vector<OracleColumnInfo> &columns) {
+    const auto &schemas = params.json_schemas;
+    for (auto &col : columns) {
+        if (col.oracle_type_name != "JSON") continue;
+        std::string column = "." + OracleUtils::ToUpper(col.name);
+        auto it = schemas.find(OracleUtils::ToUpper(schema) + "." + table + column);
+        if (it == schemas.end()) {
+            it = schemas.find(table + column);
+        }
+        if (it != schemas.end()) {
+            col.json_schema = it->second;
+        }
+    }
+}
+
 // ─── GetOrLoadTable ───────────────────────────────────────────────────────────
 
 optional_ptr<CatalogEntry>
 OracleSchemaEntry::GetOrLoadTable(const std::string &table_name) {
     std::string upper_name = OracleUtils::ToUpper(table_name);
+    auto &narrowing = ParentCatalog().Cast<OracleCatalog>().GetNumberNarrowing();
     {
         std::lock_guard<std::mutex> lk(cache_mutex_);
         auto it = table_cache_.find(upper_name);
         if (it != table_cache_.end()) {
-            return it->second.get();
+            // 整数化した列に小数が見つかっていたら、列の型を決め直す
+            auto &table = it->second->Cast<OracleTableEntry>();
+            OracleNumberNarrowing::columns_t integral;
+            if (!table.HasNarrowedColumns() ||
+                !narrowing.Get(OracleUtils::ToUpper(name) + "." + upper_name, integral) || !integral.empty()) {
+                return it->second.get();
+            }
         }
     }
 
     // Oracle から列情報をロード
     auto conn = pool_.Acquire();
     auto columns = conn->GetColumns(name, upper_name);
+    if (pool_.GetParams().number_narrowing && !columns.empty()) {
+        NarrowNumberColumns(narrowing, *conn, name, upper_name, columns);
+    }
     pool_.Release(conn);
 
     if (columns.empty()) {
         return nullptr; // テーブルが存在しない
     }
+    if (!pool_.GetParams().json_schemas.empty()) {
+        ApplyJsonSchemas(pool_.GetParams(), name, upper_name, columns);
+    }
 
     auto create_info = OracleTableInfoToCreateTableInfo(catalog, name, upper_name, columns);
     auto entry = make_uniq<OracleTableEntry>(catalog, *this, create_info, pool_);
@@ -40,7 +102,13 @@ OracleSchemaEntry::GetOrLoadTable(const std::string &table_name) {
 
     std::lock_guard<std::mutex> lk(cache_mutex_);
     auto *raw = entry.get();
-    table_cache_[upper_name] = std::move(entry);
+    auto &slot = table_cache_[upper_name];
+    if (slot) {
+        // 整数化を取り消して読み直した。古いエントリはバインド済みの問い合わせや
+        // 実行中のスキャンがまだ参照しているので、スキーマと同じだけ生かしておく
+        retired_tables_.push_back(std::move(slot));
+    }
+    slot = std::move(entry);
     return raw;
 }
 
@@ -1,4 +1,5 @@
 #include "oracle_table_entry.hpp"
+#include "oracle_catalog.hpp"
 #include "oracle_scan.hpp"
 #include "oracle_utils.hpp"
 #include "duckdb/catalog/catalog.hpp"
@@ -48,29 +49,279 @@ OracleTableEntry::GetStatistics(ClientContext &context, column_t column_id) {
     return make_uniq<NodeStatistics>();
 }
 
+// ORA_HASH に渡せる（LOB / LONG / オブジェクト型以外の）スカラー型か
+static bool IsHashableType(const std::string &oracle_type) {
+    static const char *const prefixes[] = {
+        "NUMBER", "FLOAT", "BINARY_", "VARCHAR2", "NVARCHAR2", "CHAR", "NCHAR",
+        "DATE", "TIMESTAMP", "RAW"};
+    for (const char *prefix : prefixes) {
+        if (oracle_type.rfind(prefix, 0) == 0) return true;
+    }
+    return false;
+}
+
+// ハッシュバケット分割のキー式を決める。
+//   1. ATTACH の HASH_KEYS で "SCHEMA.TABLE" または "TABLE" に指定された列
+//   2. IOT なら主キー列（primary_key）
+//   3. 先頭のハッシュ可能な列
+// 複数列は '|' 区切りで連結する（Oracle の || は NULL を空文字として扱う）
+static std::string ResolveHashKey(const OracleConnectionParameters &params,
+                                  const std::string &schema, const std::string &table,
+                                  OracleTableKind kind,
+                                  const std::vector<std::string> &primary_key,
+                                  const std::vector<OracleColumnInfo> &columns) {
+    const auto &keys = params.hash_keys;
+    std::vector<std::string> key_columns;
+
+    auto it = keys.find(OracleUtils::ToUpper(schema) + "." + OracleUtils::ToUpper(table));
+    if (it == keys.end()) {
+        it = keys.find(OracleUtils::ToUpper(table));
+    }
+    if (it != keys.end()) {
+        std::string list = it->second;
+        size_t pos = 0;
+        while (pos <= list.size()) {
+            size_t comma = list.find(',', pos);
+            if (comma == std::string::npos) comma = list.size();
+            std::string col = OracleUtils::Trim(list.substr(pos, comma - pos));
+            if (!col.empty()) key_columns.push_back(OracleUtils::ToUpper(col));
+            pos = comma + 1;
+        }
+    }
+    if (key_columns.empty() && kind == OracleTableKind::IOT) {
+        key_columns = primary_key;
+    }
+    if (key_columns.empty()) {
+        for (const auto &col : columns) {
+            if (IsHashableType(col.oracle_type_name)) {
+                key_columns.push_back(col.name);
+                break;
+            }
+        }
+    }
+
+    std::string expr;
+    for (const auto &col : key_columns) {
+        if (!expr.empty()) expr += " || '|' || ";
+        expr += OracleUtils::QuoteIdentifier(col);
+    }
+    return expr;
+}
+
+// PARALLEL_STRATEGY がキー範囲分割を許すか。
+// AUTO では索引自体がデータである IOT だけ、KEY では通常の表でも使う
+static bool AllowsRangeSplit(const OracleConnectionParameters &params, OracleTableKind kind) {
+    const auto &strategy = params.parallel_strategy;
+    return !(strategy == "ROWID" || (strategy == "AUTO" && kind != OracleTableKind::IOT));
+}
+
+// キー範囲分割に使える主キー列を返す（数値 / 日付の単一列主キーのみ）
+static std::string ResolveRangeKey(const std::vector<std::string> &primary_key,
+                                   const std::vector<OracleColumnInfo> &columns) {
+    if (primary_key.size() != 1) return std::string();
+
+    for (const auto &col : columns) {
+        if (col.name != primary_key[0]) continue;
+        const auto &type = col.oracle_type_name;
+        bool orderable = type == "NUMBER" || type == "FLOAT" || type == "DATE" ||
+                         (type.rfind("TIMESTAMP", 0) == 0 &&
+                          type.find("TIME ZONE") == std::string::npos);
+        return orderable ? col.name : std::string();
+    }
+    return std::string();
+}
+
+// 辞書ベクトルにできる文字列列か（LOB / JSON はロケータやテキストのまま返す）
+static bool IsDictionaryCandidate(const OracleColumnInfo &col, const LogicalType &type) {
+    return type.id() == LogicalTypeId::VARCHAR &&
+           col.oracle_type_name.find("LOB") == std::string::npos &&
+           col.oracle_type_name != "JSON";
+}
+
+// LOB をインラインで受け取る上限。LOB_INLINE_SIZES の "SCHEMA.TABLE" →
+// "TABLE" → LOB_INLINE_SIZE の順に決める
+static idx_t ResolveLobInlineSize(const OracleConnectionParameters &params,
+                                  const std::string &schema, const std::string &table) {
+    const auto &sizes = params.lob_inline_sizes;
+    auto it = sizes.find(OracleUtils::ToUpper(schema) + "." + OracleUtils::ToUpper(table));
+    if (it == sizes.end()) {
+        it = sizes.find(OracleUtils::ToUpper(table));
+    }
+    int size = it != sizes.end() ? it->second : params.lob_inline_size;
+    return (idx_t)MaxValue<int>(size, 0);
+}
+
+// NUMBER 列を SELECT リストで包む変換関数。NUMBER_COERCIONS の
+// "SCHEMA.TABLE.COLUMN" → "TABLE.COLUMN" → NUMBER_COERCION の順に方針を決め、
+// 値が変わらない列だけを対象にする（DECIMAL / 16 桁以上の整数はそのまま）
+static std::vector<std::string> ResolveServerCasts(const OracleConnectionParameters &params,
+                                                   const std::string &schema,
+                                                   const std::string &table,
+                                                   const std::vector<OracleColumnInfo> &columns,
+                                                   const std::vector<LogicalType> &types) {
+    std::vector<std::string> casts(columns.size());
+    bool any = false;
+    std::string qualified = OracleUtils::ToUpper(schema) + "." + OracleUtils::ToUpper(table);
+    for (idx_t i = 0; i < columns.size(); ++i) {
+        const auto &col = columns[i];
+        if (col.oracle_type_name != "NUMBER") continue;
+
+        const auto &overrides = params.number_coercions;
+        std::string column = OracleUtils::ToUpper(col.name);
+        auto it = overrides.find(qualified + "." + column);
+        if (it == overrides.end()) {
+            it = overrides.find(OracleUtils::ToUpper(table) + "." + column);
+        }
+        const auto &mode = it != overrides.end() ? it->second : params.number_coercion;
+        if (mode == "NONE") continue;
+
+        switch (types[i].id()) {
+        case LogicalTypeId::DOUBLE:
+            casts[i] = "TO_BINARY_DOUBLE";
+            break;
+        case LogicalTypeId::SMALLINT:
+        case LogicalTypeId::INTEGER:
+        case LogicalTypeId::BIGINT:
+            // 15 桁以下の整数は BINARY_DOUBLE で誤差なく表せる
+            if (mode == "ALL" && col.precision > 0 && col.precision <= 15) {
+                casts[i] = "TO_BINARY_DOUBLE";
+            }
+            break;
+        default:
+            break;
+        }
+        any = any || !casts[i].empty();
+    }
+    if (!any) casts.clear();
+    return casts;
+}
+
 TableFunction OracleTableEntry::GetScanFunction(ClientContext &context,
                                                   unique_ptr<FunctionData> &bind_data) {
     // Bind データを構築
     auto data = make_uniq<OracleScanBindData>();
     data->pool      = std::shared_ptr<OracleConnectionPool>(&pool_, [](auto *) {}); // non-owning
+    data->io_executor = &ParentCatalog().Cast<OracleCatalog>().GetIOExecutor();
+    data->memory_budget = &ParentCatalog().Cast<OracleCatalog>().GetMemoryBudget();
+    if (HasNarrowedColumns()) {
+        data->number_narrowing = &ParentCatalog().Cast<OracleCatalog>().GetNumberNarrowing();
+    }
     data->schema    = schema.name;
     data->table     = name;
     data->all_columns = oracle_columns_;
+    data->lob_inline_size = ResolveLobInlineSize(pool_.GetParams(), schema.name, name);
 
     // 型リストを構築
     for (const auto &col : oracle_columns_) {
         data->all_types.push_back(OracleTypeMapping::ToDuckDBType(col));
     }
+    data->server_casts = ResolveServerCasts(pool_.GetParams(), schema.name, name,
+                                            oracle_columns_, data->all_types);
 
-    // Oracle バージョンを取得
-    auto conn = pool_.Acquire();
-    data->oracle_major_version = conn->GetServerMajorVersion();
-    pool_.Release(conn);
+    // 辞書情報はエントリに保持し、同じ表の 2 回目以降のバインドでは問い合わせない。
+    // SCN だけはトランザクションごとに決まる
+    {
+        std::lock_guard<std::mutex> lk(scan_metadata_mutex_);
+        bool consistent_snapshot = pool_.GetParams().consistent_snapshot;
+        if (!scan_metadata_ || consistent_snapshot) {
+            auto conn = pool_.Acquire();
+            if (!scan_metadata_) {
+                scan_metadata_ = LoadScanMetadata(*conn, data->all_types);
+            }
+            // トランザクションが読む SCN（CONSISTENT_SNAPSHOT 無効、または AS OF で読めなければ 0）
+            data->snapshot_scn = OracleTransaction::Get(context, ParentCatalog())
+                                     .GetSnapshotSCN(*conn, schema.name, name);
+            pool_.Release(conn);
+        }
+        const auto &meta = *scan_metadata_;
+        data->oracle_major_version = meta.oracle_major_version;
+        data->table_kind           = meta.table_kind;
+        data->avg_row_len          = meta.avg_row_len;
+        data->partition_scheme     = meta.partition_scheme;
+        data->partitions           = meta.partitions;
+        data->hash_key             = meta.hash_key;
+        data->range_key            = meta.range_key;
+        data->dictionary_columns   = meta.dictionary_columns;
+        data->spatial_srids        = meta.spatial_srids;
+    }
 
     bind_data = std::move(data);
     return OracleScan::GetFunction();
 }
 
+// Oracle バージョン、オブジェクトの種類、パーティション構成など、スキャンが
+// 使う辞書情報を取得する。使わない情報（ビューのパーティション、分割しない表の
+// 主キー、候補列のない表の NUM_DISTINCT 等）は問い合わせない
+unique_ptr<OracleTableScanMetadata>
+OracleTableEntry::LoadScanMetadata(OracleConnection &conn,
+                                   const std::vector<LogicalType> &types) {
+    const auto &params = pool_.GetParams();
+    auto meta = make_uniq<OracleTableScanMetadata>();
+    meta->oracle_major_version = conn.GetServerMajorVersion();
+    meta->table_kind = conn.GetTableKind(schema.name, name, &meta->avg_row_len);
+
+    if (meta->table_kind == OracleTableKind::VIEW) {
+        meta->hash_key = ResolveHashKey(params, schema.name, name, meta->table_kind, {},
+                                        oracle_columns_);
+    } else {
+        meta->partition_scheme = conn.GetPartitionScheme(schema.name, name);
+        if (!meta->partition_scheme.type.empty()) {
+            meta->partitions = conn.GetPartitions(schema.name, name);
+        } else {
+            // 主キーはキー範囲分割と IOT のハッシュキーで共用する（1 回だけ読む）
+            bool is_iot = meta->table_kind == OracleTableKind::IOT;
+            bool range  = AllowsRangeSplit(params, meta->table_kind);
+            std::vector<std::string> primary_key;
+            if (range || is_iot) {
+                primary_key = conn.GetPrimaryKeyColumns(schema.name, name);
+            }
+            if (range) {
+                meta->range_key = ResolveRangeKey(primary_key, oracle_columns_);
+            }
+            if (is_iot) {
+                meta->hash_key = ResolveHashKey(params, schema.name, name, meta->table_kind,
+                                                primary_key, oracle_columns_);
+            }
+        }
+    }
+
+    // 統計上の異なり数が少ない文字列列は辞書ベクトルで返す
+    const int threshold = params.dictionary_threshold;
+    bool has_candidates = false;
+    for (idx_t i = 0; i < oracle_columns_.size(); ++i) {
+        has_candidates = has_candidates || IsDictionaryCandidate(oracle_columns_[i], types[i]);
+    }
+    if (threshold > 0 && has_candidates && meta->table_kind != OracleTableKind::VIEW) {
+        auto distinct = conn.GetColumnDistinctCounts(schema.name, name);
+        meta->dictionary_columns.resize(oracle_columns_.size(), false);
+        for (idx_t i = 0; i < oracle_columns_.size(); ++i) {
+            auto it = distinct.find(oracle_columns_[i].name);
+            meta->dictionary_columns[i] =
+                IsDictionaryCandidate(oracle_columns_[i], types[i]) &&
+                it != distinct.end() && it->second > 0 && it->second <= (idx_t)threshold;
+        }
+    }
+
+    // 空間索引のある SDO_GEOMETRY 列は、空間述語の外接矩形を SDO_FILTER で渡せる
+    for (const auto &col : oracle_columns_) {
+        if (col.oracle_type_name != "SDO_GEOMETRY") continue;
+        try {
+            meta->spatial_srids = conn.GetSpatialIndexColumns(schema.name, name);
+        } catch (const std::exception &) {
+            meta->spatial_srids.clear(); // 索引情報を参照できなければ pushdown しない
+        }
+        break;
+    }
+    return meta;
+}
+
+bool OracleTableEntry::HasNarrowedColumns() const {
+    for (const auto &col : oracle_columns_) {
+        if (col.narrowed) return true;
+    }
+    return false;
+}
+
 TableStorageInfo OracleTableEntry::GetStorageInfo(ClientContext &context) {
     TableStorageInfo info;
     info.cardinality = DConstants::INVALID_INDEX;
@@ -1,7 +1,8 @@
 #include "oracle_type_mapping.hpp"
+#include "oracle_json.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/types/hugeint.hpp"
 #include <cstring>
-#include <cmath>
 
 namespace duckdb {
 
@@ -82,6 +83,14 @@ OracleColumnInfo OracleColumnInfo::FromQueryInfo(const dpiQueryInfo &info,
     case DPI_ORACLE_TYPE_INTERVAL_DS:
         col.oracle_type_name = "INTERVAL DAY TO SECOND";
         break;
+    case DPI_ORACLE_TYPE_VECTOR:
+        col.oracle_type_name  = "VECTOR";
+        col.vector_dimensions = info.typeInfo.vectorDimensions;
+        col.vector_format     = info.typeInfo.vectorFormat;
+        break;
+    case DPI_ORACLE_TYPE_JSON:
+        col.oracle_type_name = "JSON";
+        break;
     default:
         col.oracle_type_name = "VARCHAR2";
         col.char_length = 4000;
@@ -145,6 +154,45 @@ LogicalType OracleTypeMapping::ToDuckDBType(const OracleColumnInfo &col) {
         return LogicalType::INTERVAL;
     }
 
+    if (type == "VECTOR") {
+        // 次元数が決まっていれば固定長 ARRAY、可変なら LIST。
+        // 形式が可変（*）なら値ごとに DOUBLE へそろえる
+        LogicalType element = LogicalType::DOUBLE;
+        uint32_t    size    = col.vector_dimensions;
+        switch (col.vector_format) {
+        case DPI_VECTOR_FORMAT_FLOAT32: element = LogicalType::FLOAT;   break;
+        case DPI_VECTOR_FORMAT_FLOAT64: element = LogicalType::DOUBLE;  break;
+        case DPI_VECTOR_FORMAT_INT8:    element = LogicalType::TINYINT; break;
+        case DPI_VECTOR_FORMAT_BINARY:
+            // 1 次元 1 ビット。8 次元ずつ 1 バイトに詰めたまま渡す
+            element = LogicalType::UTINYINT;
+            size    = size / 8;
+            break;
+        default:
+            break;
+        }
+        if (size > 0) {
+            return LogicalType::ARRAY(element, size);
+        }
+        return LogicalType::LIST(element);
+    }
+
+    if (type == "SDO_GEOMETRY") {
+        // SDO_UTIL.TO_WKBGEOMETRY で WKB にして受け取る。spatial 拡張の WKB_BLOB と
+        // 同じ型にしておけば、ST_* 関数の引数へは GEOMETRY に暗黙キャストされる
+        LogicalType wkb = LogicalType::BLOB;
+        wkb.SetAlias("WKB_BLOB");
+        return wkb;
+    }
+
+    if (type == "JSON") {
+        // JSON_SCHEMAS で型が指定されていれば値をその型に展開する
+        if (!col.json_schema.empty()) {
+            return TransformStringToLogicalType(col.json_schema);
+        }
+        return LogicalType::JSON();
+    }
+
     // フォールバック
     return LogicalType::VARCHAR;
 }
@@ -166,17 +214,256 @@ std::string OracleTypeMapping::ToOracleType(const LogicalType &type) {
         auto scale = DecimalType::GetScale(type);
         return "NUMBER(" + std::to_string(width) + "," + std::to_string(scale) + ")";
     }
-    case LogicalTypeId::VARCHAR:   return "VARCHAR2(4000)";
+    case LogicalTypeId::VARCHAR:   return type.IsJSONType() ? "JSON" : "VARCHAR2(4000)";
     case LogicalTypeId::BLOB:      return "BLOB";
     case LogicalTypeId::DATE:      return "DATE";
     case LogicalTypeId::TIMESTAMP: return "TIMESTAMP";
     case LogicalTypeId::TIMESTAMP_TZ: return "TIMESTAMP WITH TIME ZONE";
     case LogicalTypeId::INTERVAL:  return "INTERVAL DAY(9) TO SECOND(9)";
+    case LogicalTypeId::ARRAY:
+    case LogicalTypeId::LIST: {
+        // 数値の ARRAY / LIST は VECTOR（要素型が合わなければ文字列）
+        bool is_array  = type.id() == LogicalTypeId::ARRAY;
+        auto &element  = is_array ? ArrayType::GetChildType(type) : ListType::GetChildType(type);
+        std::string dims = is_array ? std::to_string(ArrayType::GetSize(type)) : "*";
+        switch (element.id()) {
+        case LogicalTypeId::FLOAT:   return "VECTOR(" + dims + ", FLOAT32)";
+        case LogicalTypeId::DOUBLE:  return "VECTOR(" + dims + ", FLOAT64)";
+        case LogicalTypeId::TINYINT: return "VECTOR(" + dims + ", INT8)";
+        default:                     return "VARCHAR2(4000)";
+        }
+    }
     default:
         return "VARCHAR2(4000)";
     }
 }
 
+// ─── 共通ヘルパー ─────────────────────────────────────────────────────────────
+
+// Oracle DATE / TIMESTAMP → DuckDB TIMESTAMP (microseconds since epoch)
+//
+// 暦の計算だけで求める（mktime はローカルタイムゾーン / DST を適用するうえ、
+// libc のロックを取る）。日数は Howard Hinnant の days_from_civil で、
+// 年に 4800 年（= 400 年周期 × 12）を足して負の年でも除算が切り捨てで
+// 済むようにしてあるので、分岐なしでループをベクトル化できる。
+// with_tz なら時差を引いて UTC にする
+static inline int64_t TimestampToMicros(const dpiTimestamp &ts, bool with_tz) {
+    const int64_t month = ts.month;
+    const int64_t year  = (int64_t)ts.year + 4800 - (month <= 2); // 3 月始まりの年
+    const int64_t era   = year / 400;
+    const int64_t yoe   = year - era * 400;                         // [0, 399]
+    const int64_t doy   = (153 * ((month + 9) % 12) + 2) / 5 + ts.day - 1;
+    const int64_t doe   = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    const int64_t days  = era * 146097 + doe - 719468 - 12 * 146097;
+
+    const int64_t tz_minutes = ((int64_t)ts.tzHourOffset * 60 + ts.tzMinuteOffset) * with_tz;
+    const int64_t seconds = ((days * 24 + ts.hour) * 60 + ts.minute - tz_minutes) * 60 +
+                            ts.second;
+    return seconds * 1000000LL + ts.fsecond / 1000;
+}
+
+static interval_t IntervalDSToInterval(const dpiIntervalDS &ids) {
+    interval_t iv;
+    iv.months = 0;
+    iv.days   = ids.days;
+    iv.micros = (int64_t)ids.hours * 3600000000LL +
+                (int64_t)ids.minutes * 60000000LL +
+                (int64_t)ids.seconds * 1000000LL +
+                ids.fseconds / 1000;
+    return iv;
+}
+
+// ─── NUMBER の 10 進テキスト解析 ──────────────────────────────────────────────
+//
+// NUMBER を BYTES で受け取ると ODPI-C は "-123.4500" のような指数なしの
+// 10 進表記を返す。整数部と scale 桁にそろえた小数部を 1 本の数字列にまとめ、
+// 8 桁ずつ SWAR（64bit レジスタ内の並列演算）で整数化する。double を経由
+// しないので NUMBER(38) や DECIMAL(p > 15) でも最下位桁まで正確になる。
+
+static constexpr idx_t MAX_NUMBER_DIGITS = 38;
+
+// p[0..8) がすべて '0'〜'9' か
+static inline bool IsEightDigits(const char *p) {
+    uint64_t v;
+    memcpy(&v, p, 8);
+    return (((v & 0xF0F0F0F0F0F0F0F0ULL) |
+             (((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+            0x3333333333333333ULL);
+}
+
+// 8 桁の数字列を整数化する
+static inline uint64_t ParseEightDigits(const char *p) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    uint64_t v = 0;
+    for (idx_t i = 0; i < 8; ++i) v = v * 10 + (uint64_t)(p[i] - '0');
+    return v;
+#else
+    uint64_t v;
+    memcpy(&v, p, 8);
+    v = ((v & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+    v = ((v & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+    return ((v & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32;
+#endif
+}
+
+// 数字列 digits[0..n)（n <= 19）を整数化する
+static inline uint64_t ParseDigits(const char *digits, idx_t n) {
+    uint64_t v = 0;
+    idx_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        v = v * 100000000ULL + ParseEightDigits(digits + i);
+    }
+    for (; i < n; ++i) {
+        v = v * 10 + (uint64_t)(digits[i] - '0');
+    }
+    return v;
+}
+
+// 正規化した数字列: 先頭の 0 を除いた整数部 + scale 桁の小数部
+struct OracleNumberDigits {
+    char  digits[MAX_NUMBER_DIGITS + 8];
+    idx_t count    = 0;
+    bool  negative = false;
+    bool  round_up = false;  // scale より下の桁が 5 以上（絶対値を 1 増やす）
+};
+
+// text を scale 桁の固定小数点の数字列に正規化する。
+// 指数表記や 38 桁を超える値なら false
+static bool NormalizeNumberText(const char *p, idx_t len, uint8_t scale,
+                                OracleNumberDigits &out) {
+    const char *end = p + len;
+    if (p < end && (*p == '-' || *p == '+')) {
+        out.negative = *p == '-';
+        ++p;
+    }
+    while (p < end && *p == '0') ++p;
+
+    // 整数部（8 桁単位で検査してまとめてコピー）
+    while (end - p >= 8 && IsEightDigits(p)) {
+        if (out.count + 8 > MAX_NUMBER_DIGITS) return false;
+        memcpy(out.digits + out.count, p, 8);
+        out.count += 8;
+        p += 8;
+    }
+    while (p < end && *p >= '0' && *p <= '9') {
+        if (out.count + 1 > MAX_NUMBER_DIGITS) return false;
+        out.digits[out.count++] = *p++;
+    }
+
+    // 小数部は scale 桁まで取り、次の桁で四捨五入する
+    idx_t frac = 0;
+    if (p < end && *p == '.') {
+        ++p;
+        while (p < end && *p >= '0' && *p <= '9') {
+            if (frac < scale) {
+                if (out.count + 1 > MAX_NUMBER_DIGITS) return false;
+                // 整数部が 0 なら先頭の 0 は桁数に数えない
+                if (out.count > 0 || *p != '0') out.digits[out.count++] = *p;
+                frac++;
+            } else if (frac == scale) {
+                out.round_up = *p >= '5';
+                frac++;
+            }
+            ++p;
+        }
+    }
+    if (p != end) return false; // 指数表記など
+
+    for (; frac < scale; ++frac) {
+        if (out.count == 0) continue; // 値が 0 のまま
+        if (out.count + 1 > MAX_NUMBER_DIGITS) return false;
+        out.digits[out.count++] = '0';
+    }
+    return true;
+}
+
+// NUMBER テキスト → scale 桁の DECIMAL の内部値（int16 / int32 / int64）
+template <class T>
+static bool TryParseNumberText(const char *p, idx_t len, uint8_t scale, T &result) {
+    OracleNumberDigits num;
+    if (!NormalizeNumberText(p, len, scale, num) || num.count > 18) return false;
+    int64_t v = (int64_t)ParseDigits(num.digits, num.count) + (num.round_up ? 1 : 0);
+    if (num.negative) v = -v;
+    if (v < (int64_t)NumericLimits<T>::Minimum() || v > (int64_t)NumericLimits<T>::Maximum()) {
+        return false;
+    }
+    result = (T)v;
+    return true;
+}
+
+template <>
+bool TryParseNumberText(const char *p, idx_t len, uint8_t scale, hugeint_t &result) {
+    OracleNumberDigits num;
+    if (!NormalizeNumberText(p, len, scale, num)) return false;
+    // 18 桁ずつ（10^18 < 2^63）上位から積み上げる
+    hugeint_t v = 0;
+    idx_t i = 0;
+    idx_t head = num.count % 18;
+    if (head > 0) {
+        v = hugeint_t((int64_t)ParseDigits(num.digits, head));
+        i = head;
+    }
+    for (; i < num.count; i += 18) {
+        v = v * hugeint_t(1000000000000000000LL) +
+            hugeint_t((int64_t)ParseDigits(num.digits + i, 18));
+    }
+    if (num.round_up) v += hugeint_t(1);
+    result = num.negative ? -v : v;
+    return true;
+}
+
+// CLOB / BLOB を値全体で読み取る（Value 経由の経路用。スキャンは OracleLobReader）
+static std::string ReadLob(dpiLob *lob) {
+    uint64_t lob_size = 0;
+    dpiLob_getSize(lob, &lob_size);
+    if (lob_size == 0) {
+        return std::string();
+    }
+    // CLOB の getSize は文字数なので、バイト数に換算してバッファを確保
+    uint64_t buf_size = lob_size;
+    dpiLob_getBufferSize(lob, lob_size, &buf_size);
+    std::string buf(buf_size, '\0');
+    uint64_t actual = buf_size;
+    dpiLob_readBytes(lob, 1, lob_size, &buf[0], &actual);
+    buf.resize(actual);
+    return buf;
+}
+
+// NUMBER の 10 進テキスト → DECIMAL / HUGEINT の Value（Value 経由の経路用）
+static Value NumberTextToValue(const char *p, idx_t len, const LogicalType &type) {
+    bool    decimal = type.id() == LogicalTypeId::DECIMAL;
+    uint8_t width   = decimal ? DecimalType::GetWidth(type) : 0;
+    uint8_t scale   = decimal ? DecimalType::GetScale(type) : 0;
+    switch (type.InternalType()) {
+    case PhysicalType::INT16: {
+        int16_t v;
+        if (TryParseNumberText(p, len, scale, v)) return Value::DECIMAL(v, width, scale);
+        break;
+    }
+    case PhysicalType::INT32: {
+        int32_t v;
+        if (TryParseNumberText(p, len, scale, v)) return Value::DECIMAL(v, width, scale);
+        break;
+    }
+    case PhysicalType::INT64: {
+        int64_t v;
+        if (TryParseNumberText(p, len, scale, v)) return Value::DECIMAL(v, width, scale);
+        break;
+    }
+    case PhysicalType::INT128: {
+        hugeint_t v;
+        if (TryParseNumberText(p, len, scale, v)) {
+            return decimal ? Value::DECIMAL(v, width, scale) : Value::HUGEINT(v);
+        }
+        break;
+    }
+    default:
+        break;
+    }
+    throw ConversionException("Oracle NUMBER value %s does not fit %s", std::string(p, len),
+                              type.ToString());
+}
+
 // ─── OracleTypeMapping::ToDuckDBValue ─────────────────────────────────────────
 
 Value OracleTypeMapping::ToDuckDBValue(dpiData *data,
@@ -191,13 +478,10 @@ Value OracleTypeMapping::ToDuckDBValue(dpiData *data,
         switch (target_type.id()) {
         case LogicalTypeId::FLOAT:   return Value::FLOAT((float)data->value.asDouble);
         case LogicalTypeId::DOUBLE:  return Value::DOUBLE(data->value.asDouble);
-        case LogicalTypeId::DECIMAL: {
-            double d = data->value.asDouble;
-            uint8_t width = DecimalType::GetWidth(target_type);
-            uint8_t scale = DecimalType::GetScale(target_type);
-            int64_t v = (int64_t)std::round(d * std::pow(10.0, scale));
-            return Value::DECIMAL(v, width, scale);
-        }
+        case LogicalTypeId::DECIMAL:
+            // DECIMAL は 10 進テキストで受け取る（double を経由すると桁が落ちる）
+            throw InternalException("Oracle NUMBER for %s must be fetched as text",
+                                    target_type.ToString());
         case LogicalTypeId::BIGINT:  return Value::BIGINT((int64_t)data->value.asDouble);
         case LogicalTypeId::INTEGER: return Value::INTEGER((int32_t)data->value.asDouble);
         default:
@@ -224,30 +508,22 @@ Value OracleTypeMapping::ToDuckDBValue(dpiData *data,
         if (target_type == LogicalType::BLOB) {
             return Value::BLOB(s);
         }
+        if (target_type.id() == LogicalTypeId::DECIMAL ||
+            target_type.id() == LogicalTypeId::HUGEINT) {
+            // NUMBER の 10 進テキスト。カーネル（ConvertNumberText）と同じ解析を通す
+            return NumberTextToValue(data->value.asBytes.ptr, data->value.asBytes.length,
+                                     target_type);
+        }
         return Value(s);
     }
 
     case DPI_NATIVE_TYPE_TIMESTAMP: {
-        const dpiTimestamp &ts = data->value.asTimestamp;
-        // Oracle DATE / TIMESTAMP → DuckDB TIMESTAMP (microseconds since epoch)
-        // 簡易実装: mktime を使用
-        std::tm t = {};
-        t.tm_year = ts.year - 1900;
-        t.tm_mon  = ts.month - 1;
-        t.tm_mday = ts.day;
-        t.tm_hour = ts.hour;
-        t.tm_min  = ts.minute;
-        t.tm_sec  = ts.second;
-        t.tm_isdst = -1;
-        time_t epoch = mktime(&t);
-        int64_t us = (int64_t)epoch * 1000000LL + ts.fsecond / 1000;
-
         if (target_type == LogicalType::TIMESTAMP_TZ) {
-            int32_t tz_offset_sec = (ts.tzHourOffset * 60 + ts.tzMinuteOffset) * 60;
-            us -= (int64_t)tz_offset_sec * 1000000LL;
-            return Value::TIMESTAMPTZ(timestamp_t(us));
+            return Value::TIMESTAMPTZ(
+                timestamp_t(TimestampToMicros(data->value.asTimestamp, true)));
         }
-        return Value::TIMESTAMP(timestamp_t(us));
+        return Value::TIMESTAMP(
+            timestamp_t(TimestampToMicros(data->value.asTimestamp, false)));
     }
 
     case DPI_NATIVE_TYPE_INTERVAL_YM: {
@@ -259,34 +535,15 @@ Value OracleTypeMapping::ToDuckDBValue(dpiData *data,
         return Value::INTERVAL(iv);
     }
 
-    case DPI_NATIVE_TYPE_INTERVAL_DS: {
-        const dpiIntervalDS &ids = data->value.asIntervalDS;
-        interval_t iv;
-        iv.months = 0;
-        iv.days   = ids.days;
-        iv.micros = (int64_t)ids.hours * 3600000000LL +
-                    (int64_t)ids.minutes * 60000000LL +
-                    (int64_t)ids.seconds * 1000000LL +
-                    ids.fseconds / 1000;
-        return Value::INTERVAL(iv);
-    }
+    case DPI_NATIVE_TYPE_INTERVAL_DS:
+        return Value::INTERVAL(IntervalDSToInterval(data->value.asIntervalDS));
 
     case DPI_NATIVE_TYPE_BOOLEAN:
         return Value::BOOLEAN(data->value.asBoolean != 0);
 
     case DPI_NATIVE_TYPE_LOB: {
         // CLOB / BLOB: ストリームで読み取る
-        dpiLob *lob = data->value.asLOB;
-        uint64_t lob_size = 0;
-        dpiLob_getSize(lob, &lob_size);
-        if (lob_size == 0) {
-            if (target_type == LogicalType::BLOB) return Value::BLOB("");
-            return Value(std::string(""));
-        }
-        std::string buf(lob_size, '\0');
-        uint64_t actual = lob_size;
-        dpiLob_readBytes(lob, 1, lob_size, &buf[0], &actual);
-        buf.resize(actual);
+        std::string buf = ReadLob(data->value.asLOB);
         if (target_type == LogicalType::BLOB) return Value::BLOB(buf);
         return Value(buf);
     }
@@ -297,4 +554,533 @@ Value OracleTypeMapping::ToDuckDBValue(dpiData *data,
     }
 }
 
+// ─── 変換カーネル ─────────────────────────────────────────────────────────────
+//
+// いずれも連続した dpiData 配列 data[0..count) を列方向に走査し、
+// result[offset..offset+count) に書き込む。
+
+// NULL を validity に落としつつ op で 1 セルずつ変換する共通ループ
+template <class T, class OP>
+static void ConvertColumn(dpiData *data, idx_t count, Vector &result, idx_t offset,
+                          OP &&op) {
+    auto out = FlatVector::GetData<T>(result);
+    auto &validity = FlatVector::Validity(result);
+    for (idx_t i = 0; i < count; ++i) {
+        if (data[i].isNull) {
+            validity.SetInvalid(offset + i);
+            continue;
+        }
+        out[offset + i] = op(data[i]);
+    }
+}
+
+template <class T>
+static void ConvertInt64(const OracleColumnConverter &conv, dpiData *data, idx_t count,
+                         Vector &result, idx_t offset) {
+    ConvertColumn<T>(data, count, result, offset,
+                     [](const dpiData &d) { return (T)d.value.asInt64; });
+}
+
+static void ConvertInt64ToHugeint(const OracleColumnConverter &conv, dpiData *data,
+                                  idx_t count, Vector &result, idx_t offset) {
+    ConvertColumn<hugeint_t>(data, count, result, offset,
+                             [](const dpiData &d) { return hugeint_t(d.value.asInt64); });
+}
+
+template <class T>
+static void ConvertDouble(const OracleColumnConverter &conv, dpiData *data, idx_t count,
+                          Vector &result, idx_t offset) {
+    ConvertColumn<T>(data, count, result, offset,
+                     [](const dpiData &d) { return (T)d.value.asDouble; });
+}
+
+static hugeint_t DoubleToHugeint(double d) {
+    hugeint_t v;
+    if (!Hugeint::TryConvert(d, v)) {
+        throw InvalidInputException("Oracle NUMBER value %f is out of HUGEINT range", d);
+    }
+    return v;
+}
+
+static void ConvertDoubleToHugeint(const OracleColumnConverter &conv, dpiData *data,
+                                   idx_t count, Vector &result, idx_t offset) {
+    ConvertColumn<hugeint_t>(data, count, result, offset, [](const dpiData &d) {
+        return DoubleToHugeint(d.value.asDouble);
+    });
+}
+
+// NUMBER（BYTES で受け取ったテキスト）→ DECIMAL / HUGEINT
+template <class T>
+static void ConvertNumberText(const OracleColumnConverter &conv, dpiData *data,
+                              idx_t count, Vector &result, idx_t offset) {
+    const uint8_t scale = conv.type.id() == LogicalTypeId::DECIMAL
+                              ? DecimalType::GetScale(conv.type) : 0;
+    ConvertColumn<T>(data, count, result, offset, [&](const dpiData &d) {
+        T v;
+        if (!TryParseNumberText(d.value.asBytes.ptr, d.value.asBytes.length, scale, v)) {
+            throw ConversionException("Oracle NUMBER value %s does not fit %s",
+                                      std::string(d.value.asBytes.ptr, d.value.asBytes.length),
+                                      conv.type.ToString());
+        }
+        return v;
+    });
+}
+
+// 精度なし NUMBER（統計から整数化した列）→ BIGINT / HUGEINT。
+// 丸めずに、小数を含む値は変換エラーにする
+template <class T>
+static void ConvertIntegralText(const OracleColumnConverter &conv, dpiData *data,
+                                idx_t count, Vector &result, idx_t offset) {
+    ConvertColumn<T>(data, count, result, offset, [&](const dpiData &d) {
+        const char *ptr = d.value.asBytes.ptr;
+        uint32_t    len = d.value.asBytes.length;
+        T v;
+        if (memchr(ptr, '.', len) || !TryParseNumberText(ptr, len, 0, v)) {
+            throw OracleNarrowingException(
+                "Oracle NUMBER value %s does not fit %s (the column was narrowed from "
+                "optimizer statistics; re-run the query to read it as DOUBLE)",
+                std::string(ptr, len), conv.type.ToString());
+        }
+        return v;
+    });
+}
+
+template <class T>
+static void ConvertFloat(const OracleColumnConverter &conv, dpiData *data, idx_t count,
+                         Vector &result, idx_t offset) {
+    ConvertColumn<T>(data, count, result, offset,
+                     [](const dpiData &d) { return (T)d.value.asFloat; });
+}
+
+static void ConvertBoolean(const OracleColumnConverter &conv, dpiData *data, idx_t count,
+                           Vector &result, idx_t offset) {
+    ConvertColumn<bool>(data, count, result, offset,
+                        [](const dpiData &d) { return d.value.asBoolean != 0; });
+}
+
+// 文字列 / RAW: fetch 配列のバイト列を直接参照する。12 バイト以下は string_t に
+// インライン化し、それより長い値はバッチ分の合計を 1 度だけヒープに確保して
+// そこへ 1 回ずつコピーする。TRIM_BLANKS なら CHAR の末尾の空白を同じパスで落とす
+template <bool TRIM_BLANKS>
+static void ConvertStrings(const OracleColumnConverter &conv, dpiData *data, idx_t count,
+                           Vector &result, idx_t offset) {
+    auto  out      = FlatVector::GetData<string_t>(result);
+    auto &validity = FlatVector::Validity(result);
+
+    // 1 パス目: 長さを確定し、ヒープに置く分の合計を求める
+    uint32_t lengths[STANDARD_VECTOR_SIZE];
+    idx_t heap_bytes = 0;
+    for (idx_t i = 0; i < count; ++i) {
+        if (data[i].isNull) {
+            validity.SetInvalid(offset + i);
+            continue;
+        }
+        const char *ptr = data[i].value.asBytes.ptr;
+        uint32_t    len = data[i].value.asBytes.length;
+        if (TRIM_BLANKS) {
+            while (len > 0 && ptr[len - 1] == ' ') --len;
+        }
+        lengths[i] = len;
+        if (len > string_t::INLINE_LENGTH) heap_bytes += len;
+    }
+
+    // 2 パス目: インライン化するか、確保済みの領域に詰めていく
+    char *heap = nullptr;
+    if (heap_bytes > NumericLimits<uint32_t>::Maximum()) {
+        heap_bytes = 0; // 1 つの string_t に収まらない。値ごとに確保する
+    } else if (heap_bytes > 0) {
+        heap = StringVector::EmptyString(result, heap_bytes).GetDataWriteable();
+    }
+    for (idx_t i = 0; i < count; ++i) {
+        if (data[i].isNull) continue;
+        const char *ptr = data[i].value.asBytes.ptr;
+        uint32_t    len = lengths[i];
+        if (len <= string_t::INLINE_LENGTH) {
+            out[offset + i] = string_t(ptr, len);
+        } else if (heap) {
+            memcpy(heap, ptr, len);
+            out[offset + i] = string_t(heap, len);
+            heap += len;
+        } else {
+            out[offset + i] = StringVector::AddStringOrBlob(result, ptr, len);
+        }
+    }
+}
+
+static void ConvertBytes(const OracleColumnConverter &conv, dpiData *data, idx_t count,
+                         Vector &result, idx_t offset) {
+    ConvertStrings<false>(conv, data, count, result, offset);
+}
+
+// NULL のセルも含めて配列全体を分岐なしで変換し、NULL は後から validity に落とす
+// （NULL セルの dpiTimestamp は不定値だが、整数演算なので害はない）
+template <bool WITH_TZ>
+static void ConvertTimestamps(const OracleColumnConverter &conv, dpiData *data,
+                              idx_t count, Vector &result, idx_t offset) {
+    auto out = FlatVector::GetData<timestamp_t>(result) + offset;
+    for (idx_t i = 0; i < count; ++i) {
+        out[i] = timestamp_t(TimestampToMicros(data[i].value.asTimestamp, WITH_TZ));
+    }
+    auto &validity = FlatVector::Validity(result);
+    for (idx_t i = 0; i < count; ++i) {
+        if (data[i].isNull) validity.SetInvalid(offset + i);
+    }
+}
+
+static void ConvertIntervalYM(const OracleColumnConverter &conv, dpiData *data,
+                              idx_t count, Vector &result, idx_t offset) {
+    ConvertColumn<interval_t>(data, count, result, offset, [](const dpiData &d) {
+        interval_t iv;
+        iv.months = d.value.asIntervalYM.years * 12 + d.value.asIntervalYM.months;
+        iv.days   = 0;
+        iv.micros = 0;
+        return iv;
+    });
+}
+
+static void ConvertIntervalDS(const OracleColumnConverter &conv, dpiData *data,
+                              idx_t count, Vector &result, idx_t offset) {
+    ConvertColumn<interval_t>(data, count, result, offset, [](const dpiData &d) {
+        return IntervalDSToInterval(d.value.asIntervalDS);
+    });
+}
+
+// VECTOR: dpiVector_getValue はクライアント側で値のイメージを解釈するだけで
+// 往復しない。形式と要素型が同じなら要素をまとめて memcpy する
+template <class T>
+static void CopyElements(const T *src, T *out, idx_t n) {
+    memcpy(out, src, n * sizeof(T));
+}
+
+template <class SRC, class T>
+static void CopyElements(const SRC *src, T *out, idx_t n) {
+    for (idx_t i = 0; i < n; ++i) {
+        out[i] = (T)src[i];
+    }
+}
+
+// BINARY は 1 次元 1 ビットなので、要素数はバイト数
+static idx_t VectorElementCount(const dpiVectorInfo &info) {
+    return info.format == DPI_VECTOR_FORMAT_BINARY ? info.numDimensions / 8
+                                                   : info.numDimensions;
+}
+
+static void GetVectorInfo(const dpiData &d, dpiVectorInfo &info) {
+    if (dpiVector_getValue(d.value.asVector, &info) != DPI_SUCCESS) {
+        throw IOException("Oracle VECTOR value could not be read");
+    }
+}
+
+template <class T>
+static void CopyVectorElements(const dpiVectorInfo &info, T *out) {
+    idx_t n = VectorElementCount(info);
+    switch (info.format) {
+    case DPI_VECTOR_FORMAT_FLOAT32: CopyElements(info.dimensions.asFloat, out, n);  break;
+    case DPI_VECTOR_FORMAT_FLOAT64: CopyElements(info.dimensions.asDouble, out, n); break;
+    case DPI_VECTOR_FORMAT_INT8:    CopyElements(info.dimensions.asInt8, out, n);   break;
+    case DPI_VECTOR_FORMAT_BINARY:
+        CopyElements((const uint8_t *)info.dimensions.asPtr, out, n);
+        break;
+    default:
+        throw NotImplementedException("Oracle VECTOR format %d is not supported",
+                                      (int)info.format);
+    }
+}
+
+// VECTOR(n, ...) → ARRAY(T, n): 子ベクタの行 i * n から直接書く
+template <class T>
+static void ConvertArrays(const OracleColumnConverter &conv, dpiData *data, idx_t count,
+                          Vector &result, idx_t offset) {
+    const idx_t size = ArrayType::GetSize(conv.type);
+    auto  out      = FlatVector::GetData<T>(ArrayVector::GetEntry(result));
+    auto &validity = FlatVector::Validity(result);
+    dpiVectorInfo info;
+    for (idx_t i = 0; i < count; ++i) {
+        if (data[i].isNull) {
+            validity.SetInvalid(offset + i);
+            continue;
+        }
+        GetVectorInfo(data[i], info);
+        if (VectorElementCount(info) != size) {
+            throw ConversionException("Oracle VECTOR value has %llu elements, expected %llu",
+                                      (unsigned long long)VectorElementCount(info),
+                                      (unsigned long long)size);
+        }
+        CopyVectorElements(info, out + (offset + i) * size);
+    }
+}
+
+// VECTOR(*, ...) → LIST(T): 値ごとに子ベクタの末尾へ追加する
+template <class T>
+static void ConvertLists(const OracleColumnConverter &conv, dpiData *data, idx_t count,
+                         Vector &result, idx_t offset) {
+    auto  entries  = FlatVector::GetData<list_entry_t>(result);
+    auto &validity = FlatVector::Validity(result);
+    dpiVectorInfo info;
+    for (idx_t i = 0; i < count; ++i) {
+        if (data[i].isNull) {
+            validity.SetInvalid(offset + i);
+            continue;
+        }
+        GetVectorInfo(data[i], info);
+        idx_t n    = VectorElementCount(info);
+        idx_t size = ListVector::GetListSize(result);
+        ListVector::Reserve(result, size + n);
+        CopyVectorElements(info, FlatVector::GetData<T>(ListVector::GetEntry(result)) + size);
+        ListVector::SetListSize(result, size + n);
+        entries[offset + i] = list_entry_t(size, n);
+    }
+}
+
+// JSON（OSON）: dpiJson_getValue がクライアント側でノード木にデコードする。
+// JSON / VARCHAR にはテキストを、STRUCT / LIST 等には値を直接書く
+static void ConvertJson(const OracleColumnConverter &conv, dpiData *data, idx_t count,
+                        Vector &result, idx_t offset) {
+    const bool as_text  = conv.type.id() == LogicalTypeId::VARCHAR;
+    auto       out      = as_text ? FlatVector::GetData<string_t>(result) : nullptr;
+    auto      &validity = FlatVector::Validity(result);
+    std::string text;
+    for (idx_t i = 0; i < count; ++i) {
+        if (data[i].isNull) {
+            validity.SetInvalid(offset + i);
+            continue;
+        }
+        dpiJsonNode *top = nullptr;
+        if (dpiJson_getValue(data[i].value.asJson, OracleJson::GET_VALUE_OPTIONS, &top) !=
+            DPI_SUCCESS) {
+            throw IOException("Oracle JSON value could not be read");
+        }
+        if (!as_text) {
+            OracleJson::Write(top, result, offset + i);
+            continue;
+        }
+        text.clear();
+        OracleJson::AppendText(top, text);
+        out[offset + i] = StringVector::AddString(result, text);
+    }
+}
+
+// 専用カーネルのない組み合わせ用（Value 経由）
+static void ConvertGeneric(const OracleColumnConverter &conv, dpiData *data, idx_t count,
+                           Vector &result, idx_t offset) {
+    for (idx_t i = 0; i < count; ++i) {
+        result.SetValue(offset + i, OracleTypeMapping::ToDuckDBValue(
+                                        &data[i], conv.native_type, conv.type));
+    }
+}
+
+// ─── OracleColumnConverter::Create ────────────────────────────────────────────
+
+// Oracle 型から取得時の native 型を選ぶ
+static dpiNativeTypeNum SelectNativeType(const dpiDataTypeInfo &info) {
+    switch (info.oracleTypeNum) {
+    case DPI_ORACLE_TYPE_NUMBER:
+        // 整数かどうかで分岐
+        if (info.scale == 0 && info.precision > 0 && info.precision <= 18) {
+            return DPI_NATIVE_TYPE_INT64;
+        }
+        return DPI_NATIVE_TYPE_DOUBLE;
+    case DPI_ORACLE_TYPE_NATIVE_FLOAT:
+        return DPI_NATIVE_TYPE_FLOAT;
+    case DPI_ORACLE_TYPE_NATIVE_DOUBLE:
+        return DPI_NATIVE_TYPE_DOUBLE;
+    case DPI_ORACLE_TYPE_DATE:
+    case DPI_ORACLE_TYPE_TIMESTAMP:
+    case DPI_ORACLE_TYPE_TIMESTAMP_TZ:
+    case DPI_ORACLE_TYPE_TIMESTAMP_LTZ:
+        return DPI_NATIVE_TYPE_TIMESTAMP;
+    case DPI_ORACLE_TYPE_CLOB:
+    case DPI_ORACLE_TYPE_NCLOB:
+    case DPI_ORACLE_TYPE_BLOB:
+        return DPI_NATIVE_TYPE_LOB;
+    case DPI_ORACLE_TYPE_INTERVAL_YM:
+        return DPI_NATIVE_TYPE_INTERVAL_YM;
+    case DPI_ORACLE_TYPE_INTERVAL_DS:
+        return DPI_NATIVE_TYPE_INTERVAL_DS;
+    case DPI_ORACLE_TYPE_BOOLEAN:
+        return DPI_NATIVE_TYPE_BOOLEAN;
+    case DPI_ORACLE_TYPE_ROWID:
+        // ROWID は文字列として受け取る（define は VARCHAR で行う）
+        return DPI_NATIVE_TYPE_BYTES;
+    case DPI_ORACLE_TYPE_VECTOR:
+        return DPI_NATIVE_TYPE_VECTOR;
+    case DPI_ORACLE_TYPE_JSON:
+        // テキストに直列化させず OSON のまま受け取る
+        return DPI_NATIVE_TYPE_JSON;
+    default:
+        // 文字列・RAW 等は ODPI-C の既定（BYTES）、未対応型もそのまま受け取る
+        return info.defaultNativeTypeNum;
+    }
+}
+
+OracleColumnConverter OracleColumnConverter::Create(const dpiDataTypeInfo &info,
+                                                    const LogicalType &type) {
+    OracleColumnConverter conv;
+    conv.oracle_type = info.oracleTypeNum;
+    conv.native_type = SelectNativeType(info);
+    conv.type        = type;
+    conv.convert     = ConvertGeneric;
+
+    // define 用の型とバッファサイズ
+    conv.define_type = info.oracleTypeNum;
+    conv.define_size = info.clientSizeInBytes;
+    if (info.oracleTypeNum == DPI_ORACLE_TYPE_ROWID) {
+        conv.define_type = DPI_ORACLE_TYPE_VARCHAR;
+        conv.define_size = 4000; // UROWID を含む最大長
+    }
+    if (info.oracleTypeNum == DPI_ORACLE_TYPE_NUMBER &&
+        (type.id() == LogicalTypeId::DECIMAL || type.id() == LogicalTypeId::HUGEINT)) {
+        // double では 15 桁を超えると丸められるので、10 進テキストで受け取る
+        conv.native_type = DPI_NATIVE_TYPE_BYTES;
+        conv.define_size = 48; // 符号 + 40 桁 + 小数点（バッファ見積もり用）
+        switch (type.InternalType()) {
+        case PhysicalType::INT16:  conv.convert = ConvertNumberText<int16_t>;   break;
+        case PhysicalType::INT32:  conv.convert = ConvertNumberText<int32_t>;   break;
+        case PhysicalType::INT64:  conv.convert = ConvertNumberText<int64_t>;   break;
+        case PhysicalType::INT128: conv.convert = ConvertNumberText<hugeint_t>; break;
+        default: break;
+        }
+        return conv;
+    }
+    if (info.oracleTypeNum == DPI_ORACLE_TYPE_NUMBER && info.precision == 0 &&
+        info.scale == -127 &&
+        (type.id() == LogicalTypeId::BIGINT || type.id() == LogicalTypeId::HUGEINT)) {
+        // 精度なし NUMBER を整数化した列（NUMBER_NARROWING）。統計より後に入った
+        // 小数や桁あふれを取りこぼさないよう、テキストで受け取って厳密に解析する
+        conv.native_type = DPI_NATIVE_TYPE_BYTES;
+        conv.define_size = 48;
+        conv.convert = type.id() == LogicalTypeId::BIGINT ? ConvertIntegralText<int64_t>
+                                                          : ConvertIntegralText<hugeint_t>;
+        return conv;
+    }
+    if (conv.native_type == DPI_NATIVE_TYPE_BYTES && conv.define_size == 0) {
+        conv.define_size = 1; // SELECT NULL 等の長さ 0 の列
+    }
+
+    switch (conv.native_type) {
+    case DPI_NATIVE_TYPE_INT64:
+        switch (type.id()) {
+        case LogicalTypeId::SMALLINT: conv.convert = ConvertInt64<int16_t>; break;
+        case LogicalTypeId::INTEGER:  conv.convert = ConvertInt64<int32_t>; break;
+        case LogicalTypeId::BIGINT:   conv.convert = ConvertInt64<int64_t>; break;
+        case LogicalTypeId::HUGEINT:  conv.convert = ConvertInt64ToHugeint; break;
+        case LogicalTypeId::DOUBLE:   conv.convert = ConvertInt64<double>;  break;
+        default: break;
+        }
+        break;
+
+    case DPI_NATIVE_TYPE_DOUBLE:
+        switch (type.id()) {
+        case LogicalTypeId::FLOAT:    conv.convert = ConvertDouble<float>;   break;
+        case LogicalTypeId::DOUBLE:   conv.convert = ConvertDouble<double>;  break;
+        case LogicalTypeId::SMALLINT: conv.convert = ConvertDouble<int16_t>; break;
+        case LogicalTypeId::INTEGER:  conv.convert = ConvertDouble<int32_t>; break;
+        case LogicalTypeId::BIGINT:   conv.convert = ConvertDouble<int64_t>; break;
+        case LogicalTypeId::HUGEINT:  conv.convert = ConvertDoubleToHugeint; break;
+        default: break;
+        }
+        break;
+
+    case DPI_NATIVE_TYPE_FLOAT:
+        switch (type.id()) {
+        case LogicalTypeId::FLOAT:  conv.convert = ConvertFloat<float>;  break;
+        case LogicalTypeId::DOUBLE: conv.convert = ConvertFloat<double>; break;
+        default: break;
+        }
+        break;
+
+    case DPI_NATIVE_TYPE_BOOLEAN:
+        if (type.id() == LogicalTypeId::BOOLEAN) conv.convert = ConvertBoolean;
+        break;
+
+    case DPI_NATIVE_TYPE_BYTES:
+        if (type.id() == LogicalTypeId::VARCHAR || type.id() == LogicalTypeId::BLOB) {
+            conv.convert = ConvertBytes;
+        }
+        break;
+
+    case DPI_NATIVE_TYPE_TIMESTAMP:
+        if (type.id() == LogicalTypeId::TIMESTAMP) {
+            conv.convert = ConvertTimestamps<false>;
+        } else if (type.id() == LogicalTypeId::TIMESTAMP_TZ) {
+            conv.convert = ConvertTimestamps<true>;
+        }
+        break;
+
+    case DPI_NATIVE_TYPE_INTERVAL_YM:
+        if (type.id() == LogicalTypeId::INTERVAL) conv.convert = ConvertIntervalYM;
+        break;
+
+    case DPI_NATIVE_TYPE_INTERVAL_DS:
+        if (type.id() == LogicalTypeId::INTERVAL) conv.convert = ConvertIntervalDS;
+        break;
+
+    case DPI_NATIVE_TYPE_LOB:
+        // 値全体を std::string に読んでからコピーするのを避け、カーソルが
+        // チャンク単位でベクタのヒープに直接読む
+        if (type.id() == LogicalTypeId::VARCHAR || type.id() == LogicalTypeId::BLOB) {
+            conv.stream_lob = true;
+        }
+        break;
+
+    case DPI_NATIVE_TYPE_VECTOR:
+        if (type.id() == LogicalTypeId::ARRAY) {
+            switch (ArrayType::GetChildType(type).id()) {
+            case LogicalTypeId::FLOAT:    conv.convert = ConvertArrays<float>;   break;
+            case LogicalTypeId::DOUBLE:   conv.convert = ConvertArrays<double>;  break;
+            case LogicalTypeId::TINYINT:  conv.convert = ConvertArrays<int8_t>;  break;
+            case LogicalTypeId::UTINYINT: conv.convert = ConvertArrays<uint8_t>; break;
+            default: break;
+            }
+        } else if (type.id() == LogicalTypeId::LIST) {
+            switch (ListType::GetChildType(type).id()) {
+            case LogicalTypeId::FLOAT:    conv.convert = ConvertLists<float>;   break;
+            case LogicalTypeId::DOUBLE:   conv.convert = ConvertLists<double>;  break;
+            case LogicalTypeId::TINYINT:  conv.convert = ConvertLists<int8_t>;  break;
+            case LogicalTypeId::UTINYINT: conv.convert = ConvertLists<uint8_t>; break;
+            default: break;
+            }
+        }
+        break;
+
+    case DPI_NATIVE_TYPE_JSON:
+        conv.convert = ConvertJson;
+        break;
+
+    default:
+        break;
+    }
+    return conv;
+}
+
+void OracleColumnConverter::EnableBlankTrim() {
+    if ((oracle_type == DPI_ORACLE_TYPE_CHAR || oracle_type == DPI_ORACLE_TYPE_NCHAR) &&
+        convert == ConvertBytes) {
+        convert     = ConvertStrings<true>;
+        trim_blanks = true;
+    }
+}
+
+OracleColumnConverter OracleColumnConverter::CreateInlineLob(const dpiDataTypeInfo &info,
+                                                             const LogicalType &type,
+                                                             uint32_t inline_bytes) {
+    auto conv = Create(info, type);
+    switch (info.oracleTypeNum) {
+    case DPI_ORACLE_TYPE_CLOB:  conv.define_type = DPI_ORACLE_TYPE_LONG_VARCHAR;  break;
+    case DPI_ORACLE_TYPE_NCLOB: conv.define_type = DPI_ORACLE_TYPE_LONG_NVARCHAR; break;
+    case DPI_ORACLE_TYPE_BLOB:  conv.define_type = DPI_ORACLE_TYPE_LONG_RAW;      break;
+    default:
+        return conv; // LOB でなければ通常どおり
+    }
+    // LONG 系の変数は ODPI-C が値の長さに応じて動的に確保する
+    conv.native_type = DPI_NATIVE_TYPE_BYTES;
+    conv.define_size = MaxValue<uint32_t>(inline_bytes, 1);
+    conv.convert     = ConvertGeneric;
+    conv.stream_lob  = false;
+    if (type.id() == LogicalTypeId::VARCHAR || type.id() == LogicalTypeId::BLOB) {
+        conv.convert = ConvertBytes;
+    }
+    return conv;
+}
+
 } // namespace duckdb
@@ -25,6 +25,13 @@ std::string OracleUtils::ToUpper(const std::string &s) {
     return result;
 }
 
+std::string OracleUtils::Trim(const std::string &s) {
+    size_t begin = s.find_first_not_of(" \t\r\n");
+    if (begin == std::string::npos) return std::string();
+    size_t end = s.find_last_not_of(" \t\r\n");
+    return s.substr(begin, end - begin + 1);
+}
+
 std::unordered_map<std::string, std::string>
 OracleUtils::ParseKeyValueString(const std::string &s) {
     std::unordered_map<std::string, std::string> result;
@@ -96,7 +103,7 @@ OracleConnectionParameters::ParseConnectionString(const std::string &conn_str) {
     params.schema       = get("schema");
     params.wallet_location = get("wallet", get("wallet_location"));
 
-    std::string fetch_s = get("fetch_size", "10000");
+    std::string fetch_s = get("fetch_size", "0");
     params.fetch_size   = std::stoi(fetch_s);
 
     return params;